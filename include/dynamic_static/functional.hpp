@@ -10,6 +10,9 @@
 #pragma once
 
 #include "dynamic_static/functional/action.hpp"
+#include "dynamic_static/functional/combiner.hpp"
 #include "dynamic_static/functional/delegate.hpp"
 #include "dynamic_static/functional/event.hpp"
+#include "dynamic_static/functional/scheduler.hpp"
+#include "dynamic_static/functional/serializer.hpp"
 #include "dynamic_static/functional/subscribable.hpp"
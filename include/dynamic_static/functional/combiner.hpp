@@ -0,0 +1,316 @@
+
+/*
+==========================================
+  Copyright (c) 2021 dynamic_static
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include <optional>
+#include <utility>
+
+namespace dst {
+namespace combiner {
+
+/*
+A combiner is fed each return value produced by a Delegate<R(Args...)> and reduces them to a single result
+    @note A combiner must provide bool operator()(R&& value) that returns false to stop calling further subscribers
+    @note A combiner must provide get_result() that returns the aggregate of all values it has been fed
+*/
+
+/**
+Keeps the first value produced and stops calling further subscribers
+@param <T> The type of value to combine
+*/
+template <typename T>
+class First final
+{
+public:
+    /**
+    Combines a value
+    @param [in] value The value to combine
+    @return false, the first value is always the final value
+    */
+    inline bool operator()(T&& value)
+    {
+        mResult = std::move(value);
+        return false;
+    }
+
+    /**
+    Gets this First<> object's result
+    @return This First<> object's result
+        @note The returned std::optional<> is empty if no values were produced
+    */
+    inline const std::optional<T>& get_result() const
+    {
+        return mResult;
+    }
+
+private:
+    std::optional<T> mResult;
+};
+
+/**
+Keeps the last value produced
+@param <T> The type of value to combine
+*/
+template <typename T>
+class Last final
+{
+public:
+    /**
+    Combines a value
+    @param [in] value The value to combine
+    @return true, all values must be visited to find the last value
+    */
+    inline bool operator()(T&& value)
+    {
+        mResult = std::move(value);
+        return true;
+    }
+
+    /**
+    Gets this Last<> object's result
+    @return This Last<> object's result
+        @note The returned std::optional<> is empty if no values were produced
+    */
+    inline const std::optional<T>& get_result() const
+    {
+        return mResult;
+    }
+
+private:
+    std::optional<T> mResult;
+};
+
+/**
+Accumulates a custom reduction of the values produced
+@param <T> The type of value to combine
+@param <ReducerType> The type of callable used to reduce values
+    @note ReducerType must have a signature compatible with T(T&&, T&&)
+*/
+template <typename T, typename ReducerType>
+class Reduce final
+{
+public:
+    /**
+    Constructs an instance of Reduce<>
+    @param [in] initialValue The value to begin reducing from
+    @param [in] reducer The callable used to reduce values
+    */
+    inline Reduce(T initialValue, ReducerType reducer)
+        : mResult { std::move(initialValue) }
+        , mReducer { std::move(reducer) }
+    {
+    }
+
+    /**
+    Combines a value
+    @param [in] value The value to combine
+    @return true, all values must be visited to compute the reduction
+    */
+    inline bool operator()(T&& value)
+    {
+        mResult = mReducer(std::move(mResult), std::move(value));
+        return true;
+    }
+
+    /**
+    Gets this Reduce<> object's result
+    @return This Reduce<> object's result
+    */
+    inline const T& get_result() const
+    {
+        return mResult;
+    }
+
+private:
+    T mResult;
+    ReducerType mReducer;
+};
+
+/**
+Accumulates the sum of the values produced
+@param <T> The type of value to combine
+*/
+template <typename T>
+class Sum final
+{
+public:
+    /**
+    Constructs an instance of Sum<>
+    @param [in] initialValue The value to begin summing from
+    */
+    inline Sum(T initialValue = T { })
+        : mResult { std::move(initialValue) }
+    {
+    }
+
+    /**
+    Combines a value
+    @param [in] value The value to combine
+    @return true, all values must be visited to compute the sum
+    */
+    inline bool operator()(T&& value)
+    {
+        mResult += std::move(value);
+        return true;
+    }
+
+    /**
+    Gets this Sum<> object's result
+    @return This Sum<> object's result
+    */
+    inline const T& get_result() const
+    {
+        return mResult;
+    }
+
+private:
+    T mResult;
+};
+
+/**
+Keeps the smallest value produced
+@param <T> The type of value to combine
+*/
+template <typename T>
+class Min final
+{
+public:
+    /**
+    Combines a value
+    @param [in] value The value to combine
+    @return true, all values must be visited to find the smallest value
+    */
+    inline bool operator()(T&& value)
+    {
+        if (!mResult || value < *mResult) {
+            mResult = std::move(value);
+        }
+        return true;
+    }
+
+    /**
+    Gets this Min<> object's result
+    @return This Min<> object's result
+        @note The returned std::optional<> is empty if no values were produced
+    */
+    inline const std::optional<T>& get_result() const
+    {
+        return mResult;
+    }
+
+private:
+    std::optional<T> mResult;
+};
+
+/**
+Keeps the largest value produced
+@param <T> The type of value to combine
+*/
+template <typename T>
+class Max final
+{
+public:
+    /**
+    Combines a value
+    @param [in] value The value to combine
+    @return true, all values must be visited to find the largest value
+    */
+    inline bool operator()(T&& value)
+    {
+        if (!mResult || *mResult < value) {
+            mResult = std::move(value);
+        }
+        return true;
+    }
+
+    /**
+    Gets this Max<> object's result
+    @return This Max<> object's result
+        @note The returned std::optional<> is empty if no values were produced
+    */
+    inline const std::optional<T>& get_result() const
+    {
+        return mResult;
+    }
+
+private:
+    std::optional<T> mResult;
+};
+
+/**
+Determines whether all values produced are true, stops calling further subscribers on the first false value
+@param <T> The type of value to combine
+    @note T must be contextually convertible to bool
+*/
+template <typename T = bool>
+class All final
+{
+public:
+    /**
+    Combines a value
+    @param [in] value The value to combine
+    @return Whether or not all values combined so far are true
+    */
+    inline bool operator()(T&& value)
+    {
+        mResult = static_cast<bool>(value);
+        return mResult;
+    }
+
+    /**
+    Gets this All<> object's result
+    @return Whether or not all values produced are true
+        @note Returns true if no values were produced
+    */
+    inline bool get_result() const
+    {
+        return mResult;
+    }
+
+private:
+    bool mResult { true };
+};
+
+/**
+Determines whether any value produced is true, stops calling further subscribers on the first true value
+@param <T> The type of value to combine
+    @note T must be contextually convertible to bool
+*/
+template <typename T = bool>
+class Any final
+{
+public:
+    /**
+    Combines a value
+    @param [in] value The value to combine
+    @return Whether or not no values combined so far are true
+    */
+    inline bool operator()(T&& value)
+    {
+        mResult = static_cast<bool>(value);
+        return !mResult;
+    }
+
+    /**
+    Gets this Any<> object's result
+    @return Whether or not any value produced is true
+        @note Returns false if no values were produced
+    */
+    inline bool get_result() const
+    {
+        return mResult;
+    }
+
+private:
+    bool mResult { false };
+};
+
+} // namespace combiner
+} // namespace dst
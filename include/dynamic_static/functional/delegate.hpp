@@ -10,21 +10,351 @@
 #pragma once
 
 #include "dynamic_static/functional/action.hpp"
+#include "dynamic_static/functional/combiner.hpp"
 #include "dynamic_static/functional/subscribable.hpp"
 
 #include <cassert>
+#include <cstddef>
 #include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
 #include <utility>
 
 namespace dst {
 
+/**
+Subscription management shared by Delegate<> specializations
+@param <DelegateType> The Delegate<> type deriving from this BasicDelegate<>
+    @note BasicDelegate<> is not meant to be used directly, use Delegate<> instead
+*/
+template <typename DelegateType>
+class BasicDelegate
+    : protected Subscribable
+{
+public:
+    class Collection;
+    class Handle;
+
+    /**
+    Adds a subscriber to this Delegate<>
+    @param [in] subscriber The Delegate<> subscribing to this Delegate<>
+    @return A reference to this Delegate<>
+        @note This method is a noop if it would cause a duplicate subscription
+        @note This method is a noop if it would cause a self subscription
+    */
+    inline DelegateType& operator+=(DelegateType& subscriber)
+    {
+        Subscribable::operator+=(get_subscribable(subscriber));
+        return static_cast<DelegateType&>(*this);
+    }
+
+    /**
+    Adds a subscriber to this Delegate<> and gets a ScopedConnection that removes it when destroyed
+    @param [in] subscriber The Delegate<> subscribing to this Delegate<>
+    @return A ScopedConnection that removes the given Delegate<> from this Delegate<> when destroyed
+        @note The returned ScopedConnection is empty if this would cause a self subscription
+        @note The returned ScopedConnection is empty if the given Delegate<> is already subscribed
+        @note The returned ScopedConnection may safely outlive this Delegate<> and the given Delegate<>
+    */
+    [[nodiscard]] inline ScopedConnection connect(DelegateType& subscriber)
+    {
+        return Subscribable::connect(get_subscribable(subscriber));
+    }
+
+    /**
+    Removes a subscriber from this Delegate<>
+    @param [in] subscriber The Delegate<> unsubscribing from this Delegate<>
+    @return A reference to this Delegate<>
+        @note This method is a noop if the given Delegate<> is not subscribed to this Delegate<>
+    */
+    inline DelegateType& operator-=(DelegateType& subscriber)
+    {
+        Subscribable::operator-=(get_subscribable(subscriber));
+        return static_cast<DelegateType&>(*this);
+    }
+
+    /**
+    Gets the Delegate<> objects subscribed to this Delegate<>
+    @return The Delegate<> objects subscribed to this Delegate<>
+        @note Adding or removing subscribers invalidates the returned collection's iterators
+        @note The order of subscribers is nondeterministic; ie. it is not necessarily the order they were subscribed in
+    */
+    inline Collection get_subscribers() const;
+
+    /**
+    Gets the Delegate<> objects this Delegate<> is subscribed to
+    @return The Delegate<> objects this Delegate<> is subscribed to
+        @note Adding or removing subscriptions invalidates the returned collection's iterators
+        @note The order of subscriptions is nondeterministic; ie. it is not necessarily the order they were subscribed in
+        @note An Event<> this Delegate<> is subscribed to appears as the Delegate<> it derives from
+    */
+    inline Collection get_subscriptions() const;
+
+    /**
+    Gets the number of bytes used by this Delegate<>
+    @return The number of bytes used by this Delegate<>
+        @note Each subscription is counted once, by the Delegate<> that was subscribed to
+        @note Memory allocated by this Delegate<> object's callable is not counted
+    */
+    inline size_t get_memory_usage() const
+    {
+        return sizeof(DelegateType) - sizeof(Subscribable) + Subscribable::get_memory_usage();
+    }
+
+    /**
+    Removes all subscribers from this Delegate<>
+    */
+    inline void clear_subscribers()
+    {
+        Subscribable::clear_subscribers();
+    }
+
+    /**
+    Removes all subscriptions to this Delegate<>
+    */
+    inline void clear_subscriptions()
+    {
+        Subscribable::clear_subscriptions();
+    }
+
+protected:
+    /**
+    Constructs an instance of BasicDelegate<>
+    */
+    BasicDelegate() = default;
+
+    /**
+    Moves an instance of BasicDelegate<>
+    @param [in] other The BasicDelegate<> to move from
+    */
+    BasicDelegate(BasicDelegate<DelegateType>&& other) = default;
+
+    /**
+    Moves an instance of BasicDelegate<>
+    @param [in] other The BasicDelegate<> to move from
+    @return A reference to this BasicDelegate<>
+    */
+    BasicDelegate<DelegateType>& operator=(BasicDelegate<DelegateType>&& other) = default;
+
+    /**
+    Gets the Delegate<> subscribed to this Delegate<> that a given Subscribable belongs to
+    @param [in] pSubscriber The Subscribable to get the Delegate<> for
+    @return The Delegate<> that the given Subscribable belongs to
+    */
+    static inline const DelegateType& get_delegate(const Subscribable* pSubscriber)
+    {
+        assert(pSubscriber);
+        return static_cast<const DelegateType&>(static_cast<const BasicDelegate<DelegateType>&>(*pSubscriber));
+    }
+
+private:
+    /**
+    Gets the Subscribable that a given Delegate<> derives from
+    @param [in] delegate The Delegate<> to get the Subscribable for
+    @return The Subscribable that the given Delegate<> derives from
+    */
+    static inline Subscribable& get_subscribable(DelegateType& delegate)
+    {
+        return static_cast<BasicDelegate<DelegateType>&>(delegate);
+    }
+};
+
+/**
+View of the Delegate<> objects at the far end of a Delegate<> object's subscribers or subscriptions
+@param <DelegateType> The type of Delegate<> in this Collection
+*/
+template <typename DelegateType>
+class BasicDelegate<DelegateType>::Collection final
+{
+public:
+    /**
+    Iterates over the Delegate<> objects in a Collection
+    */
+    class const_iterator final
+    {
+    public:
+        using SubscribableIterator = typename std::decay_t<decltype(std::declval<const Subscribable&>().get_subscribers())>::const_iterator;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = DelegateType*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = DelegateType* const*;
+        using reference = DelegateType*;
+
+        /**
+        Constructs an instance of Collection::const_iterator
+        @param [in] itr The iterator over Subscribable objects this iterator wraps
+        */
+        inline explicit const_iterator(SubscribableIterator itr)
+            : mItr { itr }
+        {
+        }
+
+        /**
+        Gets the Delegate<> this iterator points to
+        @return The Delegate<> this iterator points to
+        */
+        inline DelegateType* operator*() const
+        {
+            assert(*mItr);
+            return &static_cast<DelegateType&>(static_cast<BasicDelegate<DelegateType>&>(**mItr));
+        }
+
+        /**
+        Advances this iterator
+        @return A reference to this iterator
+        */
+        inline const_iterator& operator++()
+        {
+            ++mItr;
+            return *this;
+        }
+
+        /**
+        Gets whether or not this iterator points to the same Delegate<> as another iterator
+        @param [in] other The iterator to compare against
+        @return Whether or not this iterator points to the same Delegate<> as the given iterator
+        */
+        inline bool operator==(const const_iterator& other) const
+        {
+            return mItr == other.mItr;
+        }
+
+        /**
+        Gets whether or not this iterator points to a different Delegate<> than another iterator
+        @param [in] other The iterator to compare against
+        @return Whether or not this iterator points to a different Delegate<> than the given iterator
+        */
+        inline bool operator!=(const const_iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        SubscribableIterator mItr;
+    };
+
+    /**
+    Constructs an instance of Collection
+    @param [in] delegate The Delegate<> whose subscribers or subscriptions this Collection views
+    @param [in] subscribers Whether this Collection views subscribers or subscriptions
+    */
+    inline Collection(const BasicDelegate<DelegateType>& delegate, bool subscribers)
+        : mpSubscribable { &delegate }
+        , mSubscribers { subscribers }
+    {
+    }
+
+    /**
+    Gets an iterator to the first Delegate<> in this Collection
+    @return An iterator to the first Delegate<> in this Collection
+    */
+    inline const_iterator begin() const
+    {
+        return const_iterator(mSubscribers ? mpSubscribable->get_subscribers().begin() : mpSubscribable->get_subscriptions().begin());
+    }
+
+    /**
+    Gets an iterator past the last Delegate<> in this Collection
+    @return An iterator past the last Delegate<> in this Collection
+    */
+    inline const_iterator end() const
+    {
+        return const_iterator(mSubscribers ? mpSubscribable->get_subscribers().end() : mpSubscribable->get_subscriptions().end());
+    }
+
+    /**
+    Gets whether or not this Collection is empty
+    @return Whether or not this Collection is empty
+    */
+    inline bool empty() const
+    {
+        return mSubscribers ? mpSubscribable->get_subscribers().empty() : mpSubscribable->get_subscriptions().empty();
+    }
+
+    /**
+    Gets the number of Delegate<> objects in this Collection
+    @return The number of Delegate<> objects in this Collection
+        @note This method has the complexity of the underlying Subscribable object's collection
+    */
+    inline size_t size() const
+    {
+        return mSubscribers ? mpSubscribable->get_subscribers().size() : mpSubscribable->get_subscriptions().size();
+    }
+
+    /**
+    Gets the number of times a given Delegate<> appears in this Collection
+    @param [in] pDelegate The Delegate<> to count
+    @return 1 if the given Delegate<> is in this Collection, 0 otherwise
+        @note This method has the complexity of the underlying Subscribable object's collection
+    */
+    inline size_t count(DelegateType* pDelegate) const
+    {
+        auto pSubscribable = pDelegate ? &get_subscribable(*pDelegate) : nullptr;
+        return mSubscribers ? mpSubscribable->get_subscribers().count(pSubscribable) : mpSubscribable->get_subscriptions().count(pSubscribable);
+    }
+
+private:
+    const Subscribable* mpSubscribable { nullptr };
+    bool mSubscribers { true };
+};
+
+template <typename DelegateType>
+inline typename BasicDelegate<DelegateType>::Collection BasicDelegate<DelegateType>::get_subscribers() const
+{
+    return { *this, true };
+}
+
+template <typename DelegateType>
+inline typename BasicDelegate<DelegateType>::Collection BasicDelegate<DelegateType>::get_subscriptions() const
+{
+    return { *this, false };
+}
+
+/**
+Generation checked reference to a Delegate<>
+@param <DelegateType> The type of Delegate<> to reference
+    @note Handle follows its Delegate<> through std::move() and becomes stale when its Delegate<> is destroyed or move assigned to
+*/
+template <typename DelegateType>
+class BasicDelegate<DelegateType>::Handle final
+{
+public:
+    /**
+    Constructs an instance of Delegate<>::Handle
+    */
+    Handle() = default;
+
+    /**
+    Constructs an instance of Delegate<>::Handle
+    @param [in] delegate The Delegate<> to reference
+    */
+    inline explicit Handle(DelegateType& delegate)
+        : mHandle { get_subscribable(delegate) }
+    {
+    }
+
+    /**
+    Gets the Delegate<> referenced by this Delegate<>::Handle
+    @return The Delegate<> referenced by this Delegate<>::Handle, nullptr if this Delegate<>::Handle is empty or stale
+    */
+    inline DelegateType* get() const
+    {
+        auto pSubscribable = mHandle.get();
+        return pSubscribable ? &static_cast<DelegateType&>(static_cast<BasicDelegate<DelegateType>&>(*pSubscribable)) : nullptr;
+    }
+
+private:
+    Subscribable::Handle mHandle;
+};
+
 /**
 Encapsulates a Subscribable multicast Action<>
 @param <...Args> The argument types of thie Delegate<> object's Action<>
 */
 template <typename ...Args>
 class Delegate
-    : private Subscribable
+    : public BasicDelegate<Delegate<Args...>>
 {
 public:
     /**
@@ -76,83 +406,163 @@ public:
     */
     inline Delegate<Args...>& operator=(Delegate<Args...>&& other) noexcept
     {
-        Subscribable::operator=(std::move(other));
+        BasicDelegate<Delegate<Args...>>::operator=(std::move(other));
         mAction = std::move(other.mAction);
         other.mAction = nullptr;
         return *this;
     }
 
     /**
-    Adds a subscriber to this Delegate<>
-    @param [in] subscriber The Delegate<> subscribing to this Delegate<>
+    Calls this Delegate<> object's Action<> and that of all subscribed Delegate<> objects (recursively) with the given arguments
+    @param [in] args The arguments to call this Delegate<> object's Action<> and all subscribed Delegate<> objects (recursively) with
+        @note The order that subscribed Delegate<> objects are called in is nondetermninistic; ie. it is not necessarily the order they were subscribed in
+        @note This Delegate<> object and subscribed Delegate<> objects (recursively) must not add or remove subscribers during the scope of this method
+        @note This Delegate<> object and subscribed Delegate<> objects (recursively) must not std::move() during the scope of this method
+        @note This Delegate<> object and subscribed Delegate<> objects (recursively) must not be destroyed during the scope of this method
+    */
+    inline void operator()(Args&&... args) const
+    {
+        if (mAction) {
+            mAction(std::forward<Args>(args)...);
+        }
+        for (auto pSubscriber : Subscribable::get_subscribers()) {
+            this->get_delegate(pSubscriber)(std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+    Clears this Delegate<> object's Action<> and removes all subscribers from and subscriptions to this Delegate<>
+    */
+    inline void clear()
+    {
+        Subscribable::clear();
+        mAction = nullptr;
+    }
+
+private:
+    Action<Args...> mAction;
+};
+
+/**
+Encapsulates a Subscribable multicast std::function<> whose return values are fed to a combiner
+@param <R> The return type of this Delegate<> object's std::function<>
+@param <...Args> The argument types of this Delegate<> object's std::function<>
+    @note Delegate<void(Args...)> is not supported, use Delegate<Args...> instead
+*/
+template <typename R, typename ...Args>
+class Delegate<R(Args...)>
+    : public BasicDelegate<Delegate<R(Args...)>>
+{
+public:
+    static_assert(!std::is_void<R>::value, "Delegate<void(Args...)> is not supported, use Delegate<Args...> instead");
+
+    /**
+    Constructs an instance of Delegate<>
+    */
+    Delegate() = default;
+
+    /**
+    Constructs an instance of Delegate<>
+    @param <FunctionType> The type of object to assign to this Delegate<> object's std::function<>
+    @param [in] function This Delegate<> object's std::function<>
+        @note FunctionType must have a signautre compatible with this Delegate<> object's <R(Args...)> parameter
+        @note Passing nullptr for function will clear this Delegate<> object's std::function<>
+    */
+    template <typename FunctionType>
+    inline Delegate(FunctionType function)
+        : mFunction { function }
+    {
+    }
+
+    /**
+    Assigns this Delegate<> object's std::function<>
+    @param <FunctionType> The type of object to assign to this Delegate<> object's std::function<>
+    @param [in] function This Delegate<> object's std::function<>
     @return A reference to this Delegate<>
-        @note This method is a noop if it would cause a duplicate subscription
-        @note This method is a noop if it would cause a self subscription
+        @note FunctionType must have a signautre compatible with this Delegate<> object's <R(Args...)> parameter
+        @note Passing nullptr for function will clear this Delegate<> object's std::function<>
     */
-    inline Delegate<Args...>& operator+=(Delegate<Args...>& subscriber)
+    template <typename FunctionType>
+    inline Delegate<R(Args...)>& operator=(FunctionType function)
     {
-        Subscribable::operator+=(subscriber);
+        mFunction = function;
         return *this;
     }
 
     /**
-    Removes a subscriber from this Delegate<>
-    @param [in] subscriber The Delegate<> unsubscribing from this Delegate<>
+    Moves an instance of Delegate<>
+    @param [in] other The Delegate<> to move from
+    */
+    inline Delegate(Delegate<R(Args...)>&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    /**
+    Moves an instance of Delegate<>
+    @param [in] other The Delegate<> to move from
     @return A reference to this Delegate<>
-        @note This method is a noop if the given Delegate<> is not subscribed to this Delegate<>
     */
-    inline Delegate<Args...>& operator-=(Delegate<Args...>& subscriber)
+    inline Delegate<R(Args...)>& operator=(Delegate<R(Args...)>&& other) noexcept
     {
-        Subscribable::operator-=(subscriber);
+        BasicDelegate<Delegate<R(Args...)>>::operator=(std::move(other));
+        mFunction = std::move(other.mFunction);
+        other.mFunction = nullptr;
         return *this;
     }
 
     /**
-    Calls this Delegate<> object's Action<> and that of all subscribed Delegate<> objects (recursively) with the given arguments
-    @param [in] args The arguments to call this Delegate<> object's Action<> and all subscribed Delegate<> objects (recursively) with
+    Calls this Delegate<> object's std::function<> and that of all subscribed Delegate<> objects (recursively) with the given arguments, feeding each return value to the given combiner
+    @param <CombinerType> The type of combiner to feed return values to
+    @param [in] combiner The combiner to feed return values to
+    @param [in] args The arguments to call this Delegate<> object's std::function<> and all subscribed Delegate<> objects (recursively) with
+    @return Whether or not all std::function<> objects were called; ie. false if the combiner stopped early
+        @note CombinerType must provide bool operator()(R&&) that returns false to stop calling further std::function<> objects
+        @note No intermediate collection of return values is created, each value is fed to the combiner as it is produced
         @note The order that subscribed Delegate<> objects are called in is nondetermninistic; ie. it is not necessarily the order they were subscribed in
         @note This Delegate<> object and subscribed Delegate<> objects (recursively) must not add or remove subscribers during the scope of this method
         @note This Delegate<> object and subscribed Delegate<> objects (recursively) must not std::move() during the scope of this method
         @note This Delegate<> object and subscribed Delegate<> objects (recursively) must not be destroyed during the scope of this method
     */
-    inline void operator()(Args&&... args) const
+    template <typename CombinerType>
+    inline bool invoke(CombinerType& combiner, Args&&... args) const
     {
-        if (mAction) {
-            mAction(std::forward<Args>(args)...);
+        if (mFunction && !combiner(mFunction(std::forward<Args>(args)...))) {
+            return false;
         }
         for (auto pSubscriber : Subscribable::get_subscribers()) {
-            assert(pSubscriber);
-            (*(const Delegate<Args...>*)pSubscriber)(std::forward<Args>(args)...);
+            if (!this->get_delegate(pSubscriber).invoke(combiner, std::forward<Args>(args)...)) {
+                return false;
+            }
         }
+        return true;
     }
 
     /**
-    Removes all subscribers from this Delegate<>
-    */
-    inline void clear_subscribers()
-    {
-        Subscribable::clear_subscribers();
-    }
-
-    /**
-    Removes all subscriptions to this Delegate<>
+    Calls this Delegate<> object's std::function<> and that of all subscribed Delegate<> objects (recursively) with the given arguments
+    @param [in] args The arguments to call this Delegate<> object's std::function<> and all subscribed Delegate<> objects (recursively) with
+    @return The last value produced
+        @note The returned std::optional<> is empty if no std::function<> objects were called
+        @note The same restrictions that apply to invoke() apply to this method
     */
-    inline void clear_subscriptions()
+    inline std::optional<R> operator()(Args&&... args) const
     {
-        Subscribable::clear_subscriptions();
+        combiner::Last<R> combiner;
+        invoke(combiner, std::forward<Args>(args)...);
+        return combiner.get_result();
     }
 
     /**
-    Clears this Delegate<> object's Action<> and removes all subscribers from and subscriptions to this Delegate<>
+    Clears this Delegate<> object's std::function<> and removes all subscribers from and subscriptions to this Delegate<>
     */
     inline void clear()
     {
         Subscribable::clear();
-        mAction = nullptr;
+        mFunction = nullptr;
     }
 
 private:
-    Action<Args...> mAction;
+    std::function<R(Args...)> mFunction;
 };
 
 } // namespace dst
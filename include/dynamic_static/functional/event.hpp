@@ -11,6 +11,7 @@
 
 #include "dynamic_static/functional/delegate.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <utility>
 
@@ -39,6 +40,18 @@ public:
         return *this;
     }
 
+    /**
+    Adds a subscriber to this Event<> and gets a ScopedConnection that removes it when destroyed
+    @param [in] subscriber The Delegate<> subscribing to this Event<>
+    @return A ScopedConnection that removes the given Delegate<> from this Event<> when destroyed
+        @note The returned ScopedConnection is empty if the given Delegate<> is already subscribed
+        @note The returned ScopedConnection may safely outlive this Event<> and the given Delegate<>
+    */
+    [[nodiscard]] inline ScopedConnection connect(Delegate<Args...>& subscriber)
+    {
+        return Delegate<Args...>::connect(subscriber);
+    }
+
     /**
     Removes a subscriber from this Event<>
     @param [in] subscriber The Delegate<> unsubscribing from this Event<>
@@ -51,6 +64,16 @@ public:
         return *this;
     }
 
+    /**
+    Gets the number of bytes used by this Event<>
+    @return The number of bytes used by this Event<>
+        @note Each subscription is counted once, by the Event<> or Delegate<> that was subscribed to
+    */
+    inline size_t get_memory_usage() const
+    {
+        return Delegate<Args...>::get_memory_usage();
+    }
+
 private:
     friend CallerType;
 
@@ -0,0 +1,308 @@
+
+/*
+==========================================
+  Copyright (c) 2021 dynamic_static
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/functional/delegate.hpp"
+#include "dynamic_static/functional/memory_mapped_file.hpp"
+#include "dynamic_static/functional/serializer.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace dst {
+
+/**
+Header at the beginning of an event log written by EventRecorder<>
+*/
+struct EventLogHeader final
+{
+    static constexpr uint64_t Magic { 0x474f4c5645545344 }; //!< "DSTEVLOG" when stored little endian
+    static constexpr uint32_t Version { 1 };
+    uint64_t magic { Magic };
+    uint32_t version { Version };
+    uint32_t reserved { 0 };
+    uint64_t size { sizeof(EventLogHeader) }; //!< The number of bytes of the event log in use, including this header
+};
+
+/**
+Header preceding each record's serialized arguments in an event log written by EventRecorder<>
+*/
+struct EventLogRecordHeader final
+{
+    uint64_t timestamp { 0 }; //!< Nanoseconds between the start of recording and this record
+    uint64_t size { 0 };      //!< The number of bytes of serialized arguments following this header
+};
+
+/**
+Specifies how EventReplayer<> paces replayed records
+*/
+enum class ReplayTiming
+{
+    FullSpeed, //!< Replay records as fast as possible
+    Original,  //!< Replay records with the timing they were recorded with
+};
+
+/**
+Records calls to a Delegate<> or Event<> to an append-only memory mapped event log
+@param <...Args> The argument types of the Delegate<> or Event<> to record
+    @note Subscribe get_delegate() to a Delegate<> or Event<> to record its calls
+    @note Each of std::decay_t<Args>... must have a Serializer<> specialization
+    @note This header isn't included by dynamic_static/functional.hpp, include it explicitly
+*/
+template <typename ...Args>
+class EventRecorder final
+{
+public:
+    /**
+    Constructs an instance of EventRecorder<>
+    */
+    inline EventRecorder()
+        : mDelegate { [this](const std::decay_t<Args>&... args) { record(args...); } }
+    {
+    }
+
+    /**
+    Destroys this instance of EventRecorder<>
+    */
+    inline ~EventRecorder()
+    {
+        close();
+    }
+
+    /**
+    Creates an event log and begins recording to it
+    @param [in] filePath The path of the event log to create
+    @param [in] capacity The number of bytes to initially reserve for the event log
+    @return Whether or not the event log was created successfully
+        @note Any event log already open in this EventRecorder<> is closed
+        @note Record timestamps are relative to the time this method is called
+    */
+    inline bool open(const std::filesystem::path& filePath, size_t capacity = 1024 * 1024)
+    {
+        close();
+        if (!mFile.open(filePath, MemoryMappedFile::Mode::ReadWrite) || !mFile.resize(std::max(capacity, sizeof(EventLogHeader)))) {
+            mFile.close();
+            return false;
+        }
+        EventLogHeader header { };
+        memcpy(mFile.get_data(), &header, sizeof(header));
+        mStartTime = std::chrono::steady_clock::now();
+        mRecordCount = 0;
+        return true;
+    }
+
+    /**
+    Gets whether or not this EventRecorder<> is open
+    @return Whether or not this EventRecorder<> is open
+    */
+    inline bool is_open() const
+    {
+        return mFile.is_open();
+    }
+
+    /**
+    Gets this EventRecorder<> object's Delegate<>
+    @return This EventRecorder<> object's Delegate<>
+        @note Subscribe the returned Delegate<> to a Delegate<> or Event<> to record its calls
+    */
+    inline Delegate<Args...>& get_delegate()
+    {
+        return mDelegate;
+    }
+
+    /**
+    Gets the number of records written since this EventRecorder<> was opened
+    @return The number of records written since this EventRecorder<> was opened
+    */
+    inline size_t get_record_count() const
+    {
+        return mRecordCount;
+    }
+
+    /**
+    Appends a record of the given arguments to this EventRecorder<> object's event log
+    @param [in] args The arguments to record
+        @note This method is a noop if this EventRecorder<> is not open
+        @note The event log's capacity is doubled when a record doesn't fit, the record is dropped if the event log can't grow
+    */
+    inline void record(const std::decay_t<Args>&... args)
+    {
+        if (!mFile.get_data()) {
+            return;
+        }
+        EventLogRecordHeader recordHeader { };
+        recordHeader.timestamp = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStartTime).count();
+        recordHeader.size = (uint64_t)(size_t { 0 } + ... + Serializer<std::decay_t<Args>>::get_size(args));
+        auto offset = (size_t)get_header().size;
+        auto size = offset + sizeof(EventLogRecordHeader) + (size_t)recordHeader.size;
+        if (mFile.get_size() < size && !mFile.resize(std::max(mFile.get_size() * 2, size))) {
+            return;
+        }
+        assert(mFile.get_data());
+        auto pData = mFile.get_data() + offset;
+        memcpy(pData, &recordHeader, sizeof(recordHeader));
+        pData += sizeof(recordHeader);
+        ((pData = Serializer<std::decay_t<Args>>::serialize(args, pData)), ...);
+        assert(pData == mFile.get_data() + size);
+        get_header().size = size;
+        ++mRecordCount;
+    }
+
+    /**
+    Stops recording and closes this EventRecorder<> object's event log
+        @note The event log is truncated to the number of bytes in use
+    */
+    inline void close()
+    {
+        if (mFile.get_data()) {
+            mFile.resize((size_t)get_header().size);
+        }
+        mFile.close();
+    }
+
+private:
+    /**
+    Gets this EventRecorder<> object's EventLogHeader
+    @return This EventRecorder<> object's EventLogHeader
+        @note Resizing this EventRecorder<> object's MemoryMappedFile invalidates the returned reference
+    */
+    inline EventLogHeader& get_header()
+    {
+        assert(mFile.get_data());
+        return *(EventLogHeader*)mFile.get_data();
+    }
+
+    MemoryMappedFile mFile;
+    std::chrono::steady_clock::time_point mStartTime { };
+    size_t mRecordCount { 0 };
+    Delegate<Args...> mDelegate;
+    EventRecorder(const EventRecorder<Args...>&) = delete;
+    EventRecorder(EventRecorder<Args...>&&) = delete;
+    EventRecorder<Args...>& operator=(const EventRecorder<Args...>&) = delete;
+    EventRecorder<Args...>& operator=(EventRecorder<Args...>&&) = delete;
+};
+
+/**
+Replays an event log written by EventRecorder<> through a Delegate<>
+@param <...Args> The argument types of the Delegate<> to replay through
+    @note <...Args> must match the EventRecorder<> that wrote the event log
+    @note An Event<> can be replayed through by its CallerType, which has access to the Event<> object's Delegate<>
+*/
+template <typename ...Args>
+class EventReplayer final
+{
+public:
+    /**
+    Opens an event log for replay
+    @param [in] filePath The path of the event log to open
+    @return Whether or not the event log was opened successfully
+        @note Any event log already open in this EventReplayer<> is closed
+    */
+    inline bool open(const std::filesystem::path& filePath)
+    {
+        close();
+        if (mFile.open(filePath, MemoryMappedFile::Mode::Read) && sizeof(EventLogHeader) <= mFile.get_size()) {
+            EventLogHeader header { };
+            memcpy(&header, mFile.get_data(), sizeof(header));
+            if (header.magic == EventLogHeader::Magic && header.version == EventLogHeader::Version && header.size <= mFile.get_size()) {
+                mSize = (size_t)header.size;
+                return true;
+            }
+        }
+        close();
+        return false;
+    }
+
+    /**
+    Gets whether or not this EventReplayer<> is open
+    @return Whether or not this EventReplayer<> is open
+    */
+    inline bool is_open() const
+    {
+        return mFile.is_open();
+    }
+
+    /**
+    Calls a given Delegate<> with each record in this EventReplayer<> object's event log
+    @param [in] delegate The Delegate<> to call with each record
+    @param [in] timing Whether to replay as fast as possible or with the timing records were recorded with
+    @return The number of records replayed
+        @note Deserialized arguments are reused between records so replay doesn't allocate for types that reuse their storage
+        @note The same restrictions that apply to Delegate<>::operator() apply to this method
+    */
+    inline size_t replay(const Delegate<Args...>& delegate, ReplayTiming timing = ReplayTiming::FullSpeed) const
+    {
+        size_t recordCount = 0;
+        if (mFile.is_open()) {
+            auto startTime = std::chrono::steady_clock::now();
+            std::tuple<std::decay_t<Args>...> arguments;
+            auto offset = sizeof(EventLogHeader);
+            while (offset + sizeof(EventLogRecordHeader) <= mSize) {
+                EventLogRecordHeader recordHeader { };
+                memcpy(&recordHeader, mFile.get_data() + offset, sizeof(recordHeader));
+                offset += sizeof(recordHeader);
+                if (mSize - offset < recordHeader.size) {
+                    break;
+                }
+                auto pRecordEnd = mFile.get_data() + offset + (size_t)recordHeader.size;
+                if (deserialize(mFile.get_data() + offset, pRecordEnd, arguments, std::index_sequence_for<Args...> { }) != pRecordEnd) {
+                    break;
+                }
+                offset += (size_t)recordHeader.size;
+                if (timing == ReplayTiming::Original) {
+                    std::this_thread::sleep_until(startTime + std::chrono::nanoseconds(recordHeader.timestamp));
+                }
+                invoke(delegate, arguments, std::index_sequence_for<Args...> { });
+                ++recordCount;
+            }
+        }
+        return recordCount;
+    }
+
+    /**
+    Closes this EventReplayer<> object's event log
+    */
+    inline void close()
+    {
+        mFile.close();
+        mSize = 0;
+    }
+
+private:
+    template <size_t ...Indices>
+    static inline const uint8_t* deserialize(const uint8_t* pData, const uint8_t* pEnd, std::tuple<std::decay_t<Args>...>& arguments, std::index_sequence<Indices...>)
+    {
+        ((pData = pData ? Serializer<std::decay_t<Args>>::deserialize(pData, pEnd, std::get<Indices>(arguments)) : nullptr), ...);
+        (void)pEnd;
+        (void)arguments;
+        return pData;
+    }
+
+    template <size_t ...Indices>
+    static inline void invoke(const Delegate<Args...>& delegate, std::tuple<std::decay_t<Args>...>& arguments, std::index_sequence<Indices...>)
+    {
+        delegate(std::forward<Args>(std::get<Indices>(arguments))...);
+        (void)arguments;
+    }
+
+    MemoryMappedFile mFile;
+    size_t mSize { 0 };
+};
+
+} // namespace dst
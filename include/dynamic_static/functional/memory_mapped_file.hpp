@@ -0,0 +1,296 @@
+
+/*
+==========================================
+  Copyright (c) 2021 dynamic_static
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dst {
+
+/**
+Encapsulates a file mapped into memory
+    @note This header includes platform headers and isn't included by dynamic_static/functional.hpp, include it explicitly
+*/
+class MemoryMappedFile final
+{
+public:
+    /**
+    Specifies how a MemoryMappedFile is opened
+    */
+    enum class Mode
+    {
+        Read,      //!< Open an existing file for reading
+        ReadWrite, //!< Create or truncate a file for reading and writing
+    };
+
+    /**
+    Constructs an instance of MemoryMappedFile
+    */
+    MemoryMappedFile() = default;
+
+    /**
+    Moves an instance of MemoryMappedFile
+    @param [in] other The MemoryMappedFile to move from
+    */
+    inline MemoryMappedFile(MemoryMappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    /**
+    Destroys this instance of MemoryMappedFile
+    */
+    inline ~MemoryMappedFile()
+    {
+        close();
+    }
+
+    /**
+    Moves an instance of MemoryMappedFile
+    @param [in] other The MemoryMappedFile to move from
+    @return A reference to this MemoryMappedFile
+    */
+    inline MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept
+    {
+        if (this != &other) {
+            close();
+            mFile = std::exchange(other.mFile, InvalidFile);
+#ifdef _WIN32
+            mMapping = std::exchange(other.mMapping, nullptr);
+#endif
+            mpData = std::exchange(other.mpData, nullptr);
+            mSize = std::exchange(other.mSize, 0);
+            mMode = other.mMode;
+        }
+        return *this;
+    }
+
+    /**
+    Opens a file and maps it into memory
+    @param [in] filePath The path of the file to open
+    @param [in] mode Whether to open an existing file for reading or to create a file for reading and writing
+    @return Whether or not the file was opened and mapped successfully
+        @note Any file already open in this MemoryMappedFile is closed
+    */
+    inline bool open(const std::filesystem::path& filePath, Mode mode)
+    {
+        close();
+        mMode = mode;
+#ifdef _WIN32
+        auto access = mode == Mode::Read ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE;
+        auto disposition = mode == Mode::Read ? OPEN_EXISTING : CREATE_ALWAYS;
+        mFile = CreateFileW(filePath.c_str(), access, FILE_SHARE_READ, nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (mFile == InvalidFile) {
+            return false;
+        }
+        LARGE_INTEGER fileSize { };
+        if (!GetFileSizeEx(mFile, &fileSize)) {
+            close();
+            return false;
+        }
+        mSize = (size_t)fileSize.QuadPart;
+#else
+        auto flags = mode == Mode::Read ? O_RDONLY : O_RDWR | O_CREAT | O_TRUNC;
+        mFile = ::open(filePath.c_str(), flags, 0644);
+        if (mFile == InvalidFile) {
+            return false;
+        }
+        struct stat fileStat { };
+        if (fstat(mFile, &fileStat)) {
+            close();
+            return false;
+        }
+        mSize = (size_t)fileStat.st_size;
+#endif
+        if (!map()) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+    Gets whether or not this MemoryMappedFile is open
+    @return Whether or not this MemoryMappedFile is open
+    */
+    inline bool is_open() const
+    {
+        return mFile != InvalidFile;
+    }
+
+    /**
+    Gets this MemoryMappedFile object's mapped memory
+    @return This MemoryMappedFile object's mapped memory
+        @note Returns nullptr if this MemoryMappedFile is closed or empty
+        @note Calling resize() invalidates the returned pointer
+    */
+    inline uint8_t* get_data() const
+    {
+        return mpData;
+    }
+
+    /**
+    Gets the size in bytes of this MemoryMappedFile
+    @return The size in bytes of this MemoryMappedFile
+    */
+    inline size_t get_size() const
+    {
+        return mSize;
+    }
+
+    /**
+    Resizes this MemoryMappedFile and remaps it into memory
+    @param [in] size The size in bytes to resize this MemoryMappedFile to
+    @return Whether or not this MemoryMappedFile was resized and remapped successfully
+        @note This MemoryMappedFile must have been opened with Mode::ReadWrite
+        @note The contents of this MemoryMappedFile are preserved up to the smaller of its old and new sizes
+        @note On failure this MemoryMappedFile is restored to its old size, if that fails too this MemoryMappedFile is closed
+    */
+    inline bool resize(size_t size)
+    {
+        assert(is_open());
+        assert(mMode == Mode::ReadWrite);
+        auto oldSize = mSize;
+        unmap();
+        if (truncate(size) && map()) {
+            return true;
+        }
+        unmap();
+        if (!truncate(oldSize) || !map()) {
+            close();
+        }
+        return false;
+    }
+
+    /**
+    Unmaps and closes this MemoryMappedFile
+    */
+    inline void close()
+    {
+        unmap();
+        if (mFile != InvalidFile) {
+#ifdef _WIN32
+            CloseHandle(mFile);
+#else
+            ::close(mFile);
+#endif
+            mFile = InvalidFile;
+        }
+        mSize = 0;
+    }
+
+private:
+#ifdef _WIN32
+    static inline const HANDLE InvalidFile { INVALID_HANDLE_VALUE };
+#else
+    static constexpr int InvalidFile { -1 };
+#endif
+
+    /**
+    Sets the size of this MemoryMappedFile object's file
+    @param [in] size The size in bytes to set this MemoryMappedFile object's file to
+    @return Whether or not this MemoryMappedFile object's file size was set successfully
+        @note This MemoryMappedFile must be unmapped
+    */
+    inline bool truncate(size_t size)
+    {
+        assert(!mpData);
+#ifdef _WIN32
+        LARGE_INTEGER fileSize { };
+        fileSize.QuadPart = (LONGLONG)size;
+        if (!SetFilePointerEx(mFile, fileSize, nullptr, FILE_BEGIN) || !SetEndOfFile(mFile)) {
+            return false;
+        }
+#else
+        if (ftruncate(mFile, (off_t)size)) {
+            return false;
+        }
+#endif
+        mSize = size;
+        return true;
+    }
+
+    /**
+    Maps this MemoryMappedFile object's file into memory
+    @return Whether or not this MemoryMappedFile object's file was mapped successfully
+        @note Empty files are not mapped
+    */
+    inline bool map()
+    {
+        assert(!mpData);
+        if (!mSize) {
+            return true;
+        }
+#ifdef _WIN32
+        auto protection = mMode == Mode::Read ? PAGE_READONLY : PAGE_READWRITE;
+        mMapping = CreateFileMappingW(mFile, nullptr, protection, 0, 0, nullptr);
+        if (!mMapping) {
+            return false;
+        }
+        auto access = mMode == Mode::Read ? FILE_MAP_READ : FILE_MAP_WRITE;
+        mpData = (uint8_t*)MapViewOfFile(mMapping, access, 0, 0, mSize);
+#else
+        auto protection = mMode == Mode::Read ? PROT_READ : PROT_READ | PROT_WRITE;
+        auto pData = mmap(nullptr, mSize, protection, MAP_SHARED, mFile, 0);
+        mpData = pData != MAP_FAILED ? (uint8_t*)pData : nullptr;
+#endif
+        return mpData != nullptr;
+    }
+
+    /**
+    Unmaps this MemoryMappedFile object's file from memory
+    */
+    inline void unmap()
+    {
+#ifdef _WIN32
+        if (mpData) {
+            UnmapViewOfFile(mpData);
+        }
+        if (mMapping) {
+            CloseHandle(mMapping);
+            mMapping = nullptr;
+        }
+#else
+        if (mpData) {
+            munmap(mpData, mSize);
+        }
+#endif
+        mpData = nullptr;
+    }
+
+#ifdef _WIN32
+    HANDLE mFile { InvalidFile };
+    HANDLE mMapping { nullptr };
+#else
+    int mFile { InvalidFile };
+#endif
+    uint8_t* mpData { nullptr };
+    size_t mSize { 0 };
+    Mode mMode { Mode::Read };
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+};
+
+} // namespace dst
@@ -0,0 +1,418 @@
+
+/*
+==========================================
+  Copyright (c) 2021 dynamic_static
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/functional/delegate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dst {
+
+/**
+Calls Delegate<> objects after a delay or periodically, measured in ticks
+@param <...Args> The argument types of the Delegate<> objects this Scheduler<> calls
+    @note Pending timers are stored in a hierarchical timing wheel so schedule(), cancel() and tick() are O(1)
+    @note tick() skips stretches of ticks in which no timer can expire or cascade
+    @note Timers are pooled and reused, scheduling doesn't allocate once the pool has grown unless copying arguments allocates
+    @note Arguments are copy constructed in place when scheduled, std::decay_t<Args>... needn't be default constructible or assignable
+    @note Timers follow their Delegate<> through std::move() and are cancelled when their Delegate<> is destroyed or move assigned to
+    @note An Event<> can be scheduled by its CallerType, which has access to the Event<> object's Delegate<>
+*/
+template <typename ...Args>
+class Scheduler final
+{
+public:
+    /**
+    Identifies a timer scheduled with a Scheduler<>
+        @note A Timer becomes stale when its timer fires for the last time or is cancelled, stale Timer objects are safely ignored
+    */
+    struct Timer final
+    {
+        uint32_t index { InvalidTimer };
+        uint32_t generation { 0 };
+    };
+
+    /**
+    Constructs an instance of Scheduler<>
+    */
+    inline Scheduler()
+    {
+        mBuckets.fill(InvalidTimer);
+    }
+
+    /**
+    Schedules a Delegate<> to be called once after a delay
+    @param [in] delegate The Delegate<> to call
+    @param [in] delay The number of ticks to wait before calling the Delegate<>
+    @param [in] args The arguments to call the Delegate<> with
+    @return A Timer that can be used to cancel the scheduled call
+        @note A delay of 0 calls the Delegate<> during the next tick()
+        @note The given arguments are copied and stored until the Delegate<> is called
+        @note Reference arguments refer to the stored copies when the Delegate<> is called
+    */
+    inline Timer schedule(Delegate<Args...>& delegate, uint64_t delay, const std::decay_t<Args>&... args)
+    {
+        return schedule_periodic(delegate, delay, 0, args...);
+    }
+
+    /**
+    Schedules a Delegate<> to be called periodically after a delay
+    @param [in] delegate The Delegate<> to call
+    @param [in] delay The number of ticks to wait before calling the Delegate<> the first time
+    @param [in] period The number of ticks to wait between calls
+    @param [in] args The arguments to call the Delegate<> with
+    @return A Timer that can be used to cancel the scheduled calls
+        @note A period of 0 calls the Delegate<> once
+        @note The given arguments are copied and stored until the Timer is cancelled
+    */
+    inline Timer schedule_periodic(Delegate<Args...>& delegate, uint64_t delay, uint64_t period, const std::decay_t<Args>&... args)
+    {
+        auto index = acquire_node();
+        auto& node = get_node(index);
+        node.delegate = typename Delegate<Args...>::Handle(delegate);
+        node.expiration = delay < UINT64_MAX - mTick ? mTick + delay : UINT64_MAX;
+        node.period = period;
+        node.arguments.emplace(args...);
+        insert_node(index);
+        return { index, node.generation };
+    }
+
+    /**
+    Cancels a scheduled Timer
+    @param [in] timer The Timer to cancel
+    @return Whether or not the given Timer was pending
+        @note This method is a noop if the given Timer is stale
+        @note A Timer may be cancelled from within its own Delegate<>
+    */
+    inline bool cancel(const Timer& timer)
+    {
+        if (!is_pending(timer)) {
+            return false;
+        }
+        if (timer.index == mFiringNode) {
+            mFiringNodeCancelled = true;
+        } else {
+            unlink_node(timer.index);
+            release_node(timer.index);
+        }
+        return true;
+    }
+
+    /**
+    Gets whether or not a given Timer is pending
+    @param [in] timer The Timer to check
+    @return Whether or not the given Timer is pending
+    */
+    inline bool is_pending(const Timer& timer) const
+    {
+        if (timer.index < mNodeCount) {
+            const auto& node = get_node(timer.index);
+            return node.generation == timer.generation && node.bucket != FreeBucket && !(timer.index == mFiringNode && mFiringNodeCancelled);
+        }
+        return false;
+    }
+
+    /**
+    Gets the number of pending Timer objects in this Scheduler<>
+    @return The number of pending Timer objects in this Scheduler<>
+    */
+    inline size_t get_pending_count() const
+    {
+        return mPendingCount;
+    }
+
+    /**
+    Gets the number of ticks this Scheduler<> has processed
+    @return The number of ticks this Scheduler<> has processed
+    */
+    inline uint64_t get_tick() const
+    {
+        return mTick;
+    }
+
+    /**
+    Advances this Scheduler<> and calls the Delegate<> objects of Timer objects that expire
+    @param [in] tickCount The number of ticks to advance this Scheduler<>
+        @note Timer objects whose Delegate<> has been destroyed are cancelled instead of called
+        @note Delegate<> objects called by this method may schedule and cancel Timer objects
+        @note Delegate<> objects called by this method must not call tick()
+        @note The order that Timer objects expiring on the same tick are called in is nondeterministic
+    */
+    inline void tick(uint64_t tickCount = 1)
+    {
+        while (tickCount) {
+            auto idleTickCount = std::min(get_idle_tick_count(), tickCount);
+            if (idleTickCount) {
+                mTick += idleTickCount;
+                tickCount -= idleTickCount;
+                continue;
+            }
+            auto slot = (uint32_t)(mTick & SlotMask);
+            if (!slot && !cascade(1) && !cascade(2)) {
+                cascade(3);
+            }
+            auto index = std::exchange(mBuckets[slot], InvalidTimer);
+            for (auto nodeIndex = index; nodeIndex != InvalidTimer; nodeIndex = get_node(nodeIndex).next) {
+                get_node(nodeIndex).bucket = FiringBucket;
+                --mLevelNodeCounts[0];
+            }
+            mBuckets[FiringBucket] = index;
+            ++mTick;
+            --tickCount;
+            while (mBuckets[FiringBucket] != InvalidTimer) {
+                fire_node(mBuckets[FiringBucket]);
+            }
+        }
+    }
+
+private:
+    static constexpr uint32_t InvalidTimer { UINT32_MAX };
+    static constexpr uint32_t LevelCount { 4 };
+    static constexpr uint32_t SlotBits { 8 };
+    static constexpr uint32_t SlotCount { 1 << SlotBits };
+    static constexpr uint64_t SlotMask { SlotCount - 1 };
+    static constexpr uint64_t MaxDelta { (1ull << (SlotBits * LevelCount)) - 1 };
+    static constexpr uint32_t FiringBucket { LevelCount * SlotCount };
+    static constexpr uint32_t CallingBucket { FiringBucket + 1 };
+    static constexpr uint32_t FreeBucket { UINT32_MAX };
+    static constexpr uint32_t BlockSize { 1024 };
+
+    /**
+    A pending Timer linked into one of this Scheduler<> object's buckets
+    */
+    struct Node final
+    {
+        typename Delegate<Args...>::Handle delegate;
+        uint64_t expiration { 0 };
+        uint64_t period { 0 };
+        uint32_t previous { InvalidTimer };
+        uint32_t next { InvalidTimer };
+        uint32_t bucket { FreeBucket };
+        uint32_t generation { 0 };
+        std::optional<std::tuple<std::decay_t<Args>...>> arguments; //!< Engaged while this Node is scheduled
+    };
+
+    /**
+    Gets the Node at a given index
+    @param [in] index The index of the Node to get
+    @return The Node at the given index
+    */
+    inline Node& get_node(uint32_t index)
+    {
+        assert(index < mNodeCount);
+        return mBlocks[index / BlockSize][index % BlockSize];
+    }
+
+    /**
+    Gets the Node at a given index
+    @param [in] index The index of the Node to get
+    @return The Node at the given index
+    */
+    inline const Node& get_node(uint32_t index) const
+    {
+        assert(index < mNodeCount);
+        return mBlocks[index / BlockSize][index % BlockSize];
+    }
+
+    /**
+    Acquires a Node from this Scheduler<> object's pool
+    @return The index of the acquired Node
+    */
+    inline uint32_t acquire_node()
+    {
+        auto index = mFreeNode;
+        if (index != InvalidTimer) {
+            mFreeNode = get_node(index).next;
+        } else {
+            assert(mNodeCount < InvalidTimer);
+            if (mNodeCount % BlockSize == 0) {
+                mBlocks.emplace_back(new Node[BlockSize]);
+            }
+            index = mNodeCount++;
+        }
+        ++mPendingCount;
+        return index;
+    }
+
+    /**
+    Releases a Node back to this Scheduler<> object's pool, making Timer objects that reference it stale
+    @param [in] index The index of the Node to release
+        @note The Node must not be linked into a bucket
+    */
+    inline void release_node(uint32_t index)
+    {
+        auto& node = get_node(index);
+        node.bucket = FreeBucket;
+        node.arguments.reset();
+        ++node.generation;
+        node.next = mFreeNode;
+        mFreeNode = index;
+        --mPendingCount;
+    }
+
+    /**
+    Gets the number of ticks before a Node can expire or cascade
+    @return The number of ticks before a Node can expire or cascade, UINT64_MAX if no Node is linked into a level
+        @note Level n is only cascaded on ticks that are multiples of SlotCount^n
+    */
+    inline uint64_t get_idle_tick_count() const
+    {
+        for (uint32_t level = 0; level < LevelCount; ++level) {
+            if (mLevelNodeCounts[level]) {
+                return (0 - mTick) & ((1ull << (SlotBits * level)) - 1);
+            }
+        }
+        return UINT64_MAX;
+    }
+
+    /**
+    Links a Node into the bucket for its expiration
+    @param [in] index The index of the Node to link
+    */
+    inline void insert_node(uint32_t index)
+    {
+        auto& node = get_node(index);
+        auto expiration = node.expiration;
+        auto delta = expiration < mTick ? 0 : expiration - mTick;
+        if (MaxDelta < delta) {
+            delta = MaxDelta;
+            expiration = mTick + delta;
+        }
+        uint32_t level = 0;
+        while (level + 1 < LevelCount && (1ull << (SlotBits * (level + 1))) <= delta) {
+            ++level;
+        }
+        if (!delta) {
+            expiration = mTick;
+        }
+        node.bucket = level * SlotCount + (uint32_t)((expiration >> (SlotBits * level)) & SlotMask);
+        ++mLevelNodeCounts[level];
+        node.previous = InvalidTimer;
+        node.next = mBuckets[node.bucket];
+        if (node.next != InvalidTimer) {
+            get_node(node.next).previous = index;
+        }
+        mBuckets[node.bucket] = index;
+    }
+
+    /**
+    Unlinks a Node from its bucket
+    @param [in] index The index of the Node to unlink
+    */
+    inline void unlink_node(uint32_t index)
+    {
+        auto& node = get_node(index);
+        assert(node.bucket < CallingBucket);
+        if (node.previous != InvalidTimer) {
+            get_node(node.previous).next = node.next;
+        } else {
+            mBuckets[node.bucket] = node.next;
+        }
+        if (node.next != InvalidTimer) {
+            get_node(node.next).previous = node.previous;
+        }
+        if (node.bucket < FiringBucket) {
+            --mLevelNodeCounts[node.bucket / SlotCount];
+        }
+        node.previous = InvalidTimer;
+        node.next = InvalidTimer;
+        node.bucket = CallingBucket;
+    }
+
+    /**
+    Moves the Node objects in the current slot of a given level into lower levels
+    @param [in] level The level to cascade
+    @return The current slot of the given level
+    */
+    inline uint32_t cascade(uint32_t level)
+    {
+        auto slot = (uint32_t)((mTick >> (SlotBits * level)) & SlotMask);
+        auto index = std::exchange(mBuckets[level * SlotCount + slot], InvalidTimer);
+        while (index != InvalidTimer) {
+            auto next = get_node(index).next;
+            --mLevelNodeCounts[level];
+            insert_node(index);
+            index = next;
+        }
+        return slot;
+    }
+
+    /**
+    Unlinks a Node from the firing bucket and calls its Delegate<>
+    @param [in] index The index of the Node to fire
+    */
+    inline void fire_node(uint32_t index)
+    {
+        unlink_node(index);
+        const auto* pDelegate = get_node(index).delegate.get();
+        if (pDelegate) {
+            mFiringNode = index;
+            mFiringNodeCancelled = false;
+            assert(get_node(index).arguments);
+            call(*pDelegate, *get_node(index).arguments, std::index_sequence_for<Args...> { });
+            mFiringNode = InvalidTimer;
+        }
+        auto& node = get_node(index);
+        if (pDelegate && node.period && !mFiringNodeCancelled) {
+            node.expiration = node.period < UINT64_MAX - node.expiration ? node.expiration + node.period : UINT64_MAX;
+            insert_node(index);
+        } else {
+            release_node(index);
+        }
+    }
+
+    /**
+    Gets an argument stored in a Node in the form expected by Delegate<>::operator()
+    @param <T> The Delegate<> object's argument type
+    @param [in] argument The stored argument
+    @return A reference to the stored argument if T is a reference, otherwise a copy so periodic Timer objects aren't moved from
+    */
+    template <typename T>
+    static inline decltype(auto) get_argument(std::decay_t<T>& argument)
+    {
+        if constexpr (std::is_reference<T>::value) {
+            return std::forward<T>(argument);
+        } else {
+            return std::decay_t<T>(argument);
+        }
+    }
+
+    template <size_t ...Indices>
+    static inline void call(const Delegate<Args...>& delegate, std::tuple<std::decay_t<Args>...>& arguments, std::index_sequence<Indices...>)
+    {
+        delegate(get_argument<Args>(std::get<Indices>(arguments))...);
+        (void)arguments;
+    }
+
+    std::vector<std::unique_ptr<Node[]>> mBlocks;
+    std::array<uint32_t, CallingBucket> mBuckets;
+    std::array<size_t, LevelCount> mLevelNodeCounts { };
+    uint32_t mNodeCount { 0 };
+    uint32_t mFreeNode { InvalidTimer };
+    uint32_t mFiringNode { InvalidTimer };
+    bool mFiringNodeCancelled { false };
+    size_t mPendingCount { 0 };
+    uint64_t mTick { 0 };
+
+    Scheduler(const Scheduler<Args...>&) = delete;
+    Scheduler<Args...>& operator=(const Scheduler<Args...>&) = delete;
+};
+
+} // namespace dst
@@ -0,0 +1,135 @@
+
+/*
+==========================================
+  Copyright (c) 2021 dynamic_static
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace dst {
+
+/**
+Writes values of a given type to and reads them from raw memory
+@param <T> The type of value to serialize
+    @note Specialize Serializer<> to record and replay arguments that aren't trivially copyable
+    @note A specialization must provide get_size(), serialize() and deserialize() with the signatures shown below
+    @note deserialize() must return nullptr rather than read past pEnd
+*/
+template <typename T, typename = void>
+struct Serializer;
+
+/**
+Serializer<> for trivially copyable types
+@param <T> The type of value to serialize
+*/
+template <typename T>
+struct Serializer<T, std::enable_if_t<std::is_trivially_copyable<T>::value>> final
+{
+    static_assert(!std::is_pointer<T>::value, "Serializer<> can't serialize pointers, addresses aren't meaningful when deserialized");
+
+    /**
+    Gets the number of bytes required to serialize a given value
+    @param [in] value The value to get the serialized size of
+    @return The number of bytes required to serialize the given value
+    */
+    static inline size_t get_size(const T& value)
+    {
+        (void)value;
+        return sizeof(T);
+    }
+
+    /**
+    Writes a given value to raw memory
+    @param [in] value The value to write
+    @param [in] pData The memory to write to
+    @return A pointer to the memory following the written value
+        @note pData must point to at least get_size(value) bytes
+    */
+    static inline uint8_t* serialize(const T& value, uint8_t* pData)
+    {
+        memcpy(pData, &value, sizeof(T));
+        return pData + sizeof(T);
+    }
+
+    /**
+    Reads a value from raw memory
+    @param [in] pData The memory to read from
+    @param [in] pEnd The end of the memory that may be read
+    @param [out] value The value to read into
+    @return A pointer to the memory following the read value, nullptr if the value would extend past pEnd
+    */
+    static inline const uint8_t* deserialize(const uint8_t* pData, const uint8_t* pEnd, T& value)
+    {
+        if ((size_t)(pEnd - pData) < sizeof(T)) {
+            return nullptr;
+        }
+        memcpy(&value, pData, sizeof(T));
+        return pData + sizeof(T);
+    }
+};
+
+/**
+Serializer<> for std::basic_string<> of trivially copyable characters
+@param <CharType> The std::basic_string<> object's character type
+@param <TraitsType> The std::basic_string<> object's traits type
+@param <AllocatorType> The std::basic_string<> object's allocator type
+*/
+template <typename CharType, typename TraitsType, typename AllocatorType>
+struct Serializer<std::basic_string<CharType, TraitsType, AllocatorType>> final
+{
+    using StringType = std::basic_string<CharType, TraitsType, AllocatorType>;
+
+    /**
+    Gets the number of bytes required to serialize a given std::basic_string<>
+    @param [in] value The std::basic_string<> to get the serialized size of
+    @return The number of bytes required to serialize the given std::basic_string<>
+    */
+    static inline size_t get_size(const StringType& value)
+    {
+        return sizeof(uint64_t) + value.size() * sizeof(CharType);
+    }
+
+    /**
+    Writes a given std::basic_string<> to raw memory
+    @param [in] value The std::basic_string<> to write
+    @param [in] pData The memory to write to
+    @return A pointer to the memory following the written std::basic_string<>
+        @note pData must point to at least get_size(value) bytes
+    */
+    static inline uint8_t* serialize(const StringType& value, uint8_t* pData)
+    {
+        pData = Serializer<uint64_t>::serialize((uint64_t)value.size(), pData);
+        memcpy(pData, value.data(), value.size() * sizeof(CharType));
+        return pData + value.size() * sizeof(CharType);
+    }
+
+    /**
+    Reads a std::basic_string<> from raw memory
+    @param [in] pData The memory to read from
+    @param [in] pEnd The end of the memory that may be read
+    @param [out] value The std::basic_string<> to read into
+    @return A pointer to the memory following the read std::basic_string<>, nullptr if the std::basic_string<> would extend past pEnd
+    */
+    static inline const uint8_t* deserialize(const uint8_t* pData, const uint8_t* pEnd, StringType& value)
+    {
+        uint64_t size = 0;
+        pData = Serializer<uint64_t>::deserialize(pData, pEnd, size);
+        if (!pData || (uint64_t)(pEnd - pData) / sizeof(CharType) < size) {
+            return nullptr;
+        }
+        value.resize((size_t)size);
+        memcpy(&value[0], pData, (size_t)size * sizeof(CharType));
+        return pData + (size_t)size * sizeof(CharType);
+    }
+};
+
+} // namespace dst
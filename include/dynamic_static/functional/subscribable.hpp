@@ -10,17 +10,40 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
 #include <set>
 #include <utility>
+#include <vector>
+
+/*
+Define DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE to store each subscription as a single pooled edge linked into both Subscribable objects
+    @note Compact mode uses less than half the memory per subscription and never allocates per subscription once the edge pool has grown
+    @note Compact mode finds existing subscriptions in time linear in the smaller of the two Subscribable objects' edge counts
+    @note Compact mode get_subscribers() and get_subscriptions() return a Subscribable::Collection instead of a std::set<>
+    @note Compact mode edges share a single pool, so Subscribable objects must not be modified from multiple threads even if they are unrelated
+    @note DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE changes the layout of Subscribable and the return types of get_subscribers() and get_subscriptions(), so every translation unit in a program must agree on whether it's defined
+*/
 
 namespace dst {
 
+class ScopedConnection;
+
 /**
 Encapsulates a collection of mutual references
+    @note Subscribable objects share a slot table used by ScopedConnection, so Subscribable objects must not be modified, moved or destroyed on multiple threads at once even if they are unrelated
 */
 class Subscribable
 {
 public:
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+    class Collection;
+#endif
+    class Handle;
+
     /**
     Constructs an instance of Subscribable
     */
@@ -37,30 +60,51 @@ public:
 
     /**
     Destroys this instance of Subscribable
+        @note This destructor is not virtual, types deriving from Subscribable must not be destroyed via a pointer to Subscribable
     */
-    inline virtual ~Subscribable()
+    inline ~Subscribable()
     {
         clear();
+        release_slot();
     }
 
     /**
     Moves an instance of Subscribable
     @param [in] other The Subscribable to move from
     @return A reference to this Subscribable
+        @note This Subscribable object's existing subscribers and subscriptions are removed
     */
     inline Subscribable& operator=(Subscribable&& other) noexcept
     {
-        mSubscribers = std::move(other.mSubscribers);
-        for (auto pSubscriber : mSubscribers) {
-            assert(pSubscriber);
-            pSubscriber->mSubscriptions.erase(&other);
-            pSubscriber->mSubscriptions.insert(this);
-        }
-        mSubscriptions = std::move(other.mSubscriptions);
-        for (auto pSubscription : mSubscriptions) {
-            assert(pSubscription);
-            pSubscription->mSubscribers.erase(&other);
-            pSubscription->mSubscribers.insert(this);
+        if (this != &other) {
+            clear();
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+            auto& edgePool = get_edge_pool();
+            for (auto edge = other.mSubscribers; edge != InvalidEdge; edge = edgePool[edge].nextSubscriber) {
+                edgePool[edge].pPublisher = this;
+            }
+            for (auto edge = other.mSubscriptions; edge != InvalidEdge; edge = edgePool[edge].nextSubscription) {
+                edgePool[edge].pSubscriber = this;
+            }
+            mSubscribers = std::exchange(other.mSubscribers, InvalidEdge);
+            mSubscriptions = std::exchange(other.mSubscriptions, InvalidEdge);
+#else
+            mSubscribers = std::move(other.mSubscribers);
+            for (auto pSubscriber : mSubscribers) {
+                assert(pSubscriber);
+                pSubscriber->mSubscriptions.erase(&other);
+                pSubscriber->mSubscriptions.insert(this);
+            }
+            mSubscriptions = std::move(other.mSubscriptions);
+            for (auto pSubscription : mSubscriptions) {
+                assert(pSubscription);
+                pSubscription->mSubscribers.erase(&other);
+                pSubscription->mSubscribers.insert(this);
+            }
+#endif
+            release_slot();
+            mSlot = std::exchange(other.mSlot, InvalidSlot);
+            update_slot();
         }
         return *this;
     }
@@ -74,13 +118,22 @@ public:
     */
     inline Subscribable& operator+=(Subscribable& subscriber)
     {
-        if (this != &subscriber) {
-            mSubscribers.insert(&subscriber);
-            subscriber.mSubscriptions.insert(this);
-        }
+        subscribe(subscriber);
         return *this;
     }
 
+    /**
+    Adds a subscriber to this Subscribable and gets a ScopedConnection that removes it when destroyed
+    @param [in] subscriber The Subscribable subscribing to this Subscribable
+    @return A ScopedConnection that removes the given subscriber from this Subscribable when destroyed
+        @note The returned ScopedConnection is empty if this would cause a self subscription
+        @note The returned ScopedConnection is empty if the given subscriber is already subscribed, the existing subscription is unaffected
+        @note The returned ScopedConnection only refers to the subscription it added, once that subscription is removed by any means later subscriptions are unaffected by it
+        @note The returned ScopedConnection follows this Subscribable and the given subscriber through std::move()
+        @note The returned ScopedConnection may safely outlive this Subscribable and the given subscriber
+    */
+    [[nodiscard]] inline ScopedConnection connect(Subscribable& subscriber);
+
     /**
     Removes a subscriber from this Subscribable
     @param [in] subscriber The Subscribable unsubscribing from this Subscribable
@@ -89,11 +142,37 @@ public:
     */
     inline Subscribable& operator-=(Subscribable& subscriber)
     {
-        subscriber.mSubscriptions.erase(this);
-        mSubscribers.erase(&subscriber);
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+        auto edge = find_edge(*this, subscriber);
+        if (edge != InvalidEdge) {
+            erase_edge(edge);
+        }
+#else
+        if (mSubscribers.erase(&subscriber)) {
+            subscriber.mSubscriptions.erase(this);
+            erase_connection(*this, subscriber);
+        }
+#endif
         return *this;
     }
 
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+    /**
+    Gets this Subscribable subscribers
+    @return This Subscribable object's subscribers
+        @note Adding or removing sbuscribers invalidates the returned collection's iterators
+        @note The order of subscribers is nondeterministic; ie. it is not necessarily the order they were subscribed in
+    */
+    inline Collection get_subscribers() const;
+
+    /**
+    Gets this Subscribable subscriptions
+    @return This Subscribable object's subscriptions
+        @note Adding or removing subscriptions invalidates the returned collection's iterators
+        @note The order of subscriptions is nondeterministic; ie it is not necessarily the order they were subscribed in
+    */
+    inline Collection get_subscriptions() const;
+#else
     /**
     Gets this Subscribable subscribers
     @return This Subscribable object's subscribers
@@ -115,17 +194,58 @@ public:
     {
         return mSubscriptions;
     }
+#endif
+
+    /**
+    Gets the number of bytes used by this Subscribable
+    @return The number of bytes used by this Subscribable
+        @note Each subscription is counted once, by the Subscribable that was subscribed to
+        @note Summing this value for every Subscribable in a graph gives the memory used by the graph, excluding allocator overhead
+        @note Memory used to identify the subscriptions of live ScopedConnection objects is not counted
+    */
+    inline size_t get_memory_usage() const
+    {
+        size_t memoryUsage = sizeof(Subscribable);
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+        auto& edgePool = get_edge_pool();
+        for (auto edge = mSubscribers; edge != InvalidEdge; edge = edgePool[edge].nextSubscriber) {
+            memoryUsage += sizeof(Edge) + sizeof(uint32_t);
+        }
+#else
+        // Each subscription is a std::set<> node in both Subscribable objects, a
+        //  node is a red-black tree color and three links followed by the value.
+        const size_t SetNodeSize = 4 * sizeof(void*) + sizeof(Subscribable*);
+        memoryUsage += 2 * mSubscribers.size() * SetNodeSize;
+#endif
+        if (mSlot != InvalidSlot) {
+            memoryUsage += sizeof(Slot);
+        }
+        return memoryUsage;
+    }
 
     /**
     Removes all subscribers from this Subscribable
     */
     inline void clear_subscribers()
     {
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+        auto& edgePool = get_edge_pool();
+        auto edge = mSubscribers;
+        while (edge != InvalidEdge) {
+            auto nextEdge = edgePool[edge].nextSubscriber;
+            unlink_subscription_edge(edge);
+            edgePool.release(edge);
+            edge = nextEdge;
+        }
+        mSubscribers = InvalidEdge;
+#else
         for (auto pSubscriber : mSubscribers) {
             assert(pSubscriber);
             pSubscriber->mSubscriptions.erase(this);
+            erase_connection(*this, *pSubscriber);
         }
         mSubscribers.clear();
+#endif
     }
 
     /**
@@ -133,11 +253,24 @@ public:
     */
     inline void clear_subscriptions()
     {
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+        auto& edgePool = get_edge_pool();
+        auto edge = mSubscriptions;
+        while (edge != InvalidEdge) {
+            auto nextEdge = edgePool[edge].nextSubscription;
+            unlink_subscriber_edge(edge);
+            edgePool.release(edge);
+            edge = nextEdge;
+        }
+        mSubscriptions = InvalidEdge;
+#else
         for (auto pSubscription : mSubscriptions) {
             assert(pSubscription);
             pSubscription->mSubscribers.erase(this);
+            erase_connection(*pSubscription, *this);
         }
         mSubscriptions.clear();
+#endif
     }
 
     /**
@@ -150,10 +283,687 @@ public:
     }
 
 private:
+    friend class ScopedConnection;
+    static constexpr uint32_t InvalidSlot { UINT32_MAX };
+
+    /**
+    Adds a subscriber to this Subscribable
+    @param [in] subscriber The Subscribable subscribing to this Subscribable
+    @return Whether or not the given subscriber was added; ie. false if it would cause a duplicate or self subscription
+    */
+    inline bool subscribe(Subscribable& subscriber)
+    {
+        if (this != &subscriber) {
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+            if (find_edge(*this, subscriber) == InvalidEdge) {
+                link_edge(*this, subscriber);
+                return true;
+            }
+#else
+            if (mSubscribers.insert(&subscriber).second) {
+                subscriber.mSubscriptions.insert(this);
+                return true;
+            }
+#endif
+        }
+        return false;
+    }
+
+    /**
+    Entry in the table of live Subscribable objects referenced by Handle objects
+    */
+    struct Slot final
+    {
+        Subscribable* pSubscribable { nullptr };
+        uint32_t generation { 0 };
+        uint32_t nextFreeSlot { InvalidSlot };
+    };
+
+    /**
+    Table of live Subscribable objects referenced by Handle objects
+    */
+    struct SlotTable final
+    {
+        std::vector<Slot> slots;
+        uint32_t freeSlot { InvalidSlot };
+#ifndef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+        std::map<std::pair<uint32_t, uint32_t>, uint64_t> connections; //!< Connection ids of live ScopedConnection subscriptions keyed by publisher and subscriber slot
+        uint64_t connectionCount { 0 };
+#endif
+    };
+
+    /**
+    Gets the SlotTable shared by all Subscribable objects
+    @return The SlotTable shared by all Subscribable objects
+        @note The SlotTable is never destroyed so that Subscribable objects with static storage duration may be safely destroyed in any order
+        @note The SlotTable is not synchronized, it is written by connect(), std::move() and destruction of any Subscribable that has acquired a slot
+    */
+    static inline SlotTable& get_slot_table()
+    {
+        static SlotTable* spSlotTable = new SlotTable;
+        return *spSlotTable;
+    }
+
+    /**
+    Acquires a slot in the SlotTable for this Subscribable if it doesn't have one
+    @return This Subscribable object's slot
+    */
+    inline uint32_t acquire_slot()
+    {
+        if (mSlot == InvalidSlot) {
+            auto& slotTable = get_slot_table();
+            if (slotTable.freeSlot != InvalidSlot) {
+                mSlot = slotTable.freeSlot;
+                slotTable.freeSlot = slotTable.slots[mSlot].nextFreeSlot;
+            } else {
+                assert(slotTable.slots.size() < InvalidSlot);
+                mSlot = (uint32_t)slotTable.slots.size();
+                slotTable.slots.emplace_back();
+            }
+            update_slot();
+        }
+        return mSlot;
+    }
+
+    /**
+    Points this Subscribable object's slot at this Subscribable
+    */
+    inline void update_slot()
+    {
+        if (mSlot != InvalidSlot) {
+            get_slot_table().slots[mSlot].pSubscribable = this;
+        }
+    }
+
+    /**
+    Releases this Subscribable object's slot, invalidating all Handle objects that reference it
+    */
+    inline void release_slot()
+    {
+        if (mSlot != InvalidSlot) {
+            auto& slotTable = get_slot_table();
+            auto& slot = slotTable.slots[mSlot];
+            slot.pSubscribable = nullptr;
+            ++slot.generation;
+            slot.nextFreeSlot = slotTable.freeSlot;
+            slotTable.freeSlot = mSlot;
+            mSlot = InvalidSlot;
+        }
+    }
+
+#ifndef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+    /**
+    Forgets the ScopedConnection id of the subscription of a given subscriber to a given publisher
+    @param [in] publisher The Subscribable subscribed to
+    @param [in] subscriber The Subscribable subscribing
+        @note This method must be called whenever a subscription is removed so a ScopedConnection never acts on a later subscription
+    */
+    static inline void erase_connection(const Subscribable& publisher, const Subscribable& subscriber)
+    {
+        if (publisher.mSlot != InvalidSlot && subscriber.mSlot != InvalidSlot) {
+            auto& connections = get_slot_table().connections;
+            if (!connections.empty()) {
+                connections.erase({ publisher.mSlot, subscriber.mSlot });
+            }
+        }
+    }
+#endif
+
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+    static constexpr uint32_t InvalidEdge { UINT32_MAX };
+
+    /**
+    A subscription linked into both its publisher's subscriber list and its subscriber's subscription list
+    */
+    struct Edge final
+    {
+        Subscribable* pPublisher { nullptr };
+        Subscribable* pSubscriber { nullptr };
+        uint32_t previousSubscriber { InvalidEdge };
+        uint32_t nextSubscriber { InvalidEdge };
+        uint32_t previousSubscription { InvalidEdge };
+        uint32_t nextSubscription { InvalidEdge };
+    };
+
+    /**
+    Pool of Edge objects addressed by index, grown in fixed size blocks that are never moved
+        @note Each Edge has a generation that is incremented when it's released so a ScopedConnection can tell whether its Edge still holds its subscription
+    */
+    class EdgePool final
+    {
+    public:
+        static constexpr uint32_t BlockSize { 4096 };
+
+        /**
+        Gets the Edge at a given index
+        @param [in] edge The index of the Edge to get
+        @return The Edge at the given index
+        */
+        inline Edge& operator[](uint32_t edge)
+        {
+            assert(edge < mEdgeCount);
+            return mBlocks[edge / BlockSize][edge % BlockSize];
+        }
+
+        /**
+        Gets the generation of the Edge at a given index
+        @param [in] edge The index of the Edge to get the generation of
+        @return The generation of the Edge at the given index
+        */
+        inline uint32_t get_generation(uint32_t edge) const
+        {
+            assert(edge < mEdgeCount);
+            return mGenerationBlocks[edge / BlockSize][edge % BlockSize];
+        }
+
+        /**
+        Acquires an Edge from this EdgePool
+        @return The index of the acquired Edge
+        */
+        inline uint32_t acquire()
+        {
+            auto edge = mFreeEdge;
+            if (edge != InvalidEdge) {
+                mFreeEdge = (*this)[edge].nextSubscriber;
+            } else {
+                assert(mEdgeCount < InvalidEdge);
+                if (mEdgeCount % BlockSize == 0) {
+                    mBlocks.emplace_back(new Edge[BlockSize]);
+                    mGenerationBlocks.emplace_back(new uint32_t[BlockSize] { });
+                }
+                edge = mEdgeCount++;
+            }
+            (*this)[edge] = { };
+            return edge;
+        }
+
+        /**
+        Releases an Edge back to this EdgePool
+        @param [in] edge The index of the Edge to release
+        */
+        inline void release(uint32_t edge)
+        {
+            ++mGenerationBlocks[edge / BlockSize][edge % BlockSize];
+            (*this)[edge].nextSubscriber = mFreeEdge;
+            mFreeEdge = edge;
+        }
+
+    private:
+        std::vector<std::unique_ptr<Edge[]>> mBlocks;
+        std::vector<std::unique_ptr<uint32_t[]>> mGenerationBlocks;
+        uint32_t mEdgeCount { 0 };
+        uint32_t mFreeEdge { InvalidEdge };
+    };
+
+    /**
+    Gets the EdgePool shared by all Subscribable objects
+    @return The EdgePool shared by all Subscribable objects
+        @note The EdgePool is never destroyed so that Subscribable objects with static storage duration may be safely destroyed in any order
+    */
+    static inline EdgePool& get_edge_pool()
+    {
+        static EdgePool* spEdgePool = new EdgePool;
+        return *spEdgePool;
+    }
+
+    /**
+    Finds the Edge subscribing a given subscriber to a given publisher
+    @param [in] publisher The Subscribable subscribed to
+    @param [in] subscriber The Subscribable subscribing
+    @return The index of the Edge subscribing subscriber to publisher, InvalidEdge if none exists
+        @note Both edge lists are walked together so this method stops when the shorter list is exhausted
+    */
+    static inline uint32_t find_edge(const Subscribable& publisher, const Subscribable& subscriber)
+    {
+        auto& edgePool = get_edge_pool();
+        auto subscriberEdge = publisher.mSubscribers;
+        auto subscriptionEdge = subscriber.mSubscriptions;
+        while (subscriberEdge != InvalidEdge && subscriptionEdge != InvalidEdge) {
+            if (edgePool[subscriberEdge].pSubscriber == &subscriber) {
+                return subscriberEdge;
+            }
+            if (edgePool[subscriptionEdge].pPublisher == &publisher) {
+                return subscriptionEdge;
+            }
+            subscriberEdge = edgePool[subscriberEdge].nextSubscriber;
+            subscriptionEdge = edgePool[subscriptionEdge].nextSubscription;
+        }
+        return InvalidEdge;
+    }
+
+    /**
+    Acquires an Edge subscribing a given subscriber to a given publisher
+    @param [in] publisher The Subscribable subscribed to
+    @param [in] subscriber The Subscribable subscribing
+    */
+    static inline void link_edge(Subscribable& publisher, Subscribable& subscriber)
+    {
+        auto& edgePool = get_edge_pool();
+        auto edge = edgePool.acquire();
+        auto& edgeData = edgePool[edge];
+        edgeData.pPublisher = &publisher;
+        edgeData.pSubscriber = &subscriber;
+        edgeData.nextSubscriber = publisher.mSubscribers;
+        edgeData.nextSubscription = subscriber.mSubscriptions;
+        if (publisher.mSubscribers != InvalidEdge) {
+            edgePool[publisher.mSubscribers].previousSubscriber = edge;
+        }
+        if (subscriber.mSubscriptions != InvalidEdge) {
+            edgePool[subscriber.mSubscriptions].previousSubscription = edge;
+        }
+        publisher.mSubscribers = edge;
+        subscriber.mSubscriptions = edge;
+    }
+
+    /**
+    Unlinks an Edge from both of its lists and releases it
+    @param [in] edge The index of the Edge to erase
+    */
+    static inline void erase_edge(uint32_t edge)
+    {
+        unlink_subscriber_edge(edge);
+        unlink_subscription_edge(edge);
+        get_edge_pool().release(edge);
+    }
+
+    /**
+    Unlinks an Edge from its publisher's subscriber list
+    @param [in] edge The index of the Edge to unlink
+    */
+    static inline void unlink_subscriber_edge(uint32_t edge)
+    {
+        auto& edgePool = get_edge_pool();
+        auto& edgeData = edgePool[edge];
+        if (edgeData.previousSubscriber != InvalidEdge) {
+            edgePool[edgeData.previousSubscriber].nextSubscriber = edgeData.nextSubscriber;
+        } else {
+            assert(edgeData.pPublisher);
+            edgeData.pPublisher->mSubscribers = edgeData.nextSubscriber;
+        }
+        if (edgeData.nextSubscriber != InvalidEdge) {
+            edgePool[edgeData.nextSubscriber].previousSubscriber = edgeData.previousSubscriber;
+        }
+    }
+
+    /**
+    Unlinks an Edge from its subscriber's subscription list
+    @param [in] edge The index of the Edge to unlink
+    */
+    static inline void unlink_subscription_edge(uint32_t edge)
+    {
+        auto& edgePool = get_edge_pool();
+        auto& edgeData = edgePool[edge];
+        if (edgeData.previousSubscription != InvalidEdge) {
+            edgePool[edgeData.previousSubscription].nextSubscription = edgeData.nextSubscription;
+        } else {
+            assert(edgeData.pSubscriber);
+            edgeData.pSubscriber->mSubscriptions = edgeData.nextSubscription;
+        }
+        if (edgeData.nextSubscription != InvalidEdge) {
+            edgePool[edgeData.nextSubscription].previousSubscription = edgeData.previousSubscription;
+        }
+    }
+
+    uint32_t mSubscribers { InvalidEdge };
+    uint32_t mSubscriptions { InvalidEdge };
+#else
     std::set<Subscribable*> mSubscribers;
     std::set<Subscribable*> mSubscriptions;
+#endif
+    uint32_t mSlot { InvalidSlot };
     Subscribable(const Subscribable&) = delete;
     Subscribable& operator=(const Subscribable&) = delete;
 };
 
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+/**
+View of the Subscribable objects at the far end of a Subscribable object's subscribers or subscriptions
+*/
+class Subscribable::Collection final
+{
+public:
+    /**
+    Iterates over the Subscribable objects in a Collection
+    */
+    class const_iterator final
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Subscribable*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Subscribable* const*;
+        using reference = Subscribable*;
+
+        /**
+        Constructs an instance of Collection::const_iterator
+        @param [in] edge The index of the Edge this iterator points to
+        @param [in] subscribers Whether this iterator walks a subscriber list or a subscription list
+        */
+        inline const_iterator(uint32_t edge, bool subscribers)
+            : mEdge { edge }
+            , mSubscribers { subscribers }
+        {
+        }
+
+        /**
+        Gets the Subscribable this iterator points to
+        @return The Subscribable this iterator points to
+        */
+        inline Subscribable* operator*() const
+        {
+            auto& edgeData = get_edge_pool()[mEdge];
+            return mSubscribers ? edgeData.pSubscriber : edgeData.pPublisher;
+        }
+
+        /**
+        Advances this iterator
+        @return A reference to this iterator
+        */
+        inline const_iterator& operator++()
+        {
+            auto& edgeData = get_edge_pool()[mEdge];
+            mEdge = mSubscribers ? edgeData.nextSubscriber : edgeData.nextSubscription;
+            return *this;
+        }
+
+        /**
+        Gets whether or not this iterator points to the same Edge as another iterator
+        @param [in] other The iterator to compare against
+        @return Whether or not this iterator points to the same Edge as the given iterator
+        */
+        inline bool operator==(const const_iterator& other) const
+        {
+            return mEdge == other.mEdge;
+        }
+
+        /**
+        Gets whether or not this iterator points to a different Edge than another iterator
+        @param [in] other The iterator to compare against
+        @return Whether or not this iterator points to a different Edge than the given iterator
+        */
+        inline bool operator!=(const const_iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        uint32_t mEdge { InvalidEdge };
+        bool mSubscribers { true };
+    };
+
+    /**
+    Constructs an instance of Collection
+    @param [in] edge The index of the first Edge in this Collection
+    @param [in] subscribers Whether this Collection views a subscriber list or a subscription list
+    */
+    inline Collection(uint32_t edge, bool subscribers)
+        : mEdge { edge }
+        , mSubscribers { subscribers }
+    {
+    }
+
+    /**
+    Gets an iterator to the first Subscribable in this Collection
+    @return An iterator to the first Subscribable in this Collection
+    */
+    inline const_iterator begin() const
+    {
+        return { mEdge, mSubscribers };
+    }
+
+    /**
+    Gets an iterator past the last Subscribable in this Collection
+    @return An iterator past the last Subscribable in this Collection
+    */
+    inline const_iterator end() const
+    {
+        return { InvalidEdge, mSubscribers };
+    }
+
+    /**
+    Gets whether or not this Collection is empty
+    @return Whether or not this Collection is empty
+    */
+    inline bool empty() const
+    {
+        return mEdge == InvalidEdge;
+    }
+
+    /**
+    Gets the number of Subscribable objects in this Collection
+    @return The number of Subscribable objects in this Collection
+        @note This method is linear in the number of Subscribable objects in this Collection
+    */
+    inline size_t size() const
+    {
+        size_t size = 0;
+        for (auto itr = begin(); itr != end(); ++itr) {
+            ++size;
+        }
+        return size;
+    }
+
+    /**
+    Gets the number of times a given Subscribable appears in this Collection
+    @param [in] pSubscribable The Subscribable to count
+    @return 1 if the given Subscribable is in this Collection, 0 otherwise
+        @note This method is linear in the number of Subscribable objects in this Collection
+    */
+    inline size_t count(const Subscribable* pSubscribable) const
+    {
+        for (auto pItrSubscribable : *this) {
+            if (pItrSubscribable == pSubscribable) {
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+private:
+    uint32_t mEdge { InvalidEdge };
+    bool mSubscribers { true };
+};
+
+inline Subscribable::Collection Subscribable::get_subscribers() const
+{
+    return { mSubscribers, true };
+}
+
+inline Subscribable::Collection Subscribable::get_subscriptions() const
+{
+    return { mSubscriptions, false };
+}
+#endif
+
+/**
+Generation checked reference to a Subscribable
+    @note Handle follows its Subscribable through std::move() and becomes stale when its Subscribable is destroyed or move assigned to
+    @note Creating a Handle acquires a slot in the table shared by all Subscribable objects, the slot is released when the Subscribable is destroyed
+*/
+class Subscribable::Handle final
+{
+public:
+    /**
+    Constructs an instance of Subscribable::Handle
+    */
+    Handle() = default;
+
+    /**
+    Constructs an instance of Subscribable::Handle
+    @param [in] subscribable The Subscribable to reference
+    */
+    inline explicit Handle(Subscribable& subscribable)
+        : mSlot { subscribable.acquire_slot() }
+        , mGeneration { get_slot_table().slots[mSlot].generation }
+    {
+    }
+
+    /**
+    Gets the Subscribable referenced by this Subscribable::Handle
+    @return The Subscribable referenced by this Subscribable::Handle, nullptr if this Subscribable::Handle is empty or stale
+    */
+    inline Subscribable* get() const
+    {
+        const auto& slotTable = get_slot_table();
+        if (mSlot < slotTable.slots.size()) {
+            const auto& slot = slotTable.slots[mSlot];
+            if (slot.generation == mGeneration) {
+                return slot.pSubscribable;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    uint32_t mSlot { InvalidSlot };
+    uint32_t mGeneration { 0 };
+};
+
+/**
+Removes a subscriber from a Subscribable when destroyed
+    @note ScopedConnection refers to the single subscription that created it, so it's a noop once that subscription is removed by any means, even if the same Subscribable objects subscribe again
+    @note In compact mode ScopedConnection refers to its subscription by Edge index and generation, otherwise by the slots of both Subscribable objects and a connection id
+*/
+class ScopedConnection final
+{
+public:
+    /**
+    Constructs an instance of ScopedConnection
+    */
+    ScopedConnection() = default;
+
+    /**
+    Moves an instance of ScopedConnection
+    @param [in] other The ScopedConnection to move from
+    */
+    inline ScopedConnection(ScopedConnection&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    /**
+    Destroys this instance of ScopedConnection
+    */
+    inline ~ScopedConnection()
+    {
+        disconnect();
+    }
+
+    /**
+    Moves an instance of ScopedConnection
+    @param [in] other The ScopedConnection to move from
+    @return A reference to this ScopedConnection
+        @note This ScopedConnection is disconnected before taking ownership of the given ScopedConnection object's subscription
+    */
+    inline ScopedConnection& operator=(ScopedConnection&& other) noexcept
+    {
+        if (this != &other) {
+            disconnect();
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+            mEdge = other.mEdge;
+            mGeneration = other.mGeneration;
+#else
+            mPublisher = other.mPublisher;
+            mSubscriber = other.mSubscriber;
+            mConnection = other.mConnection;
+#endif
+            other.release();
+        }
+        return *this;
+    }
+
+    /**
+    Gets whether or not this ScopedConnection object's subscription exists
+    @return Whether or not this ScopedConnection object's subscription exists
+    */
+    inline bool connected() const
+    {
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+        return mEdge != Subscribable::InvalidEdge && Subscribable::get_edge_pool().get_generation(mEdge) == mGeneration;
+#else
+        auto pPublisher = mPublisher.get();
+        auto pSubscriber = mSubscriber.get();
+        if (pPublisher && pSubscriber) {
+            const auto& connections = Subscribable::get_slot_table().connections;
+            auto itr = connections.find({ pPublisher->mSlot, pSubscriber->mSlot });
+            return itr != connections.end() && itr->second == mConnection;
+        }
+        return false;
+#endif
+    }
+
+    /**
+    Removes this ScopedConnection object's subscription
+        @note This method is a noop if this ScopedConnection object's subscription has already been removed
+    */
+    inline void disconnect()
+    {
+        if (connected()) {
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+            Subscribable::erase_edge(mEdge);
+#else
+            *mPublisher.get() -= *mSubscriber.get();
+#endif
+        }
+        release();
+    }
+
+    /**
+    Releases this ScopedConnection object's subscription without removing it
+    */
+    inline void release()
+    {
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+        mEdge = Subscribable::InvalidEdge;
+        mGeneration = 0;
+#else
+        mPublisher = { };
+        mSubscriber = { };
+        mConnection = 0;
+#endif
+    }
+
+private:
+    friend class Subscribable;
+
+    /**
+    Constructs an instance of ScopedConnection
+    @param [in] publisher The Subscribable that subscriber was just subscribed to
+    @param [in] subscriber The Subscribable that was just subscribed to publisher
+    */
+    inline ScopedConnection(Subscribable& publisher, Subscribable& subscriber)
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+        // Subscribable::link_edge() pushes new Edge objects to the front of both lists
+        : mEdge { publisher.mSubscribers }
+        , mGeneration { Subscribable::get_edge_pool().get_generation(publisher.mSubscribers) }
+    {
+        assert(Subscribable::get_edge_pool()[mEdge].pSubscriber == &subscriber);
+    }
+#else
+        : mPublisher { publisher }
+        , mSubscriber { subscriber }
+    {
+        auto& slotTable = Subscribable::get_slot_table();
+        mConnection = ++slotTable.connectionCount;
+        slotTable.connections[{ publisher.mSlot, subscriber.mSlot }] = mConnection;
+    }
+#endif
+
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+    uint32_t mEdge { Subscribable::InvalidEdge };
+    uint32_t mGeneration { 0 };
+#else
+    Subscribable::Handle mPublisher;
+    Subscribable::Handle mSubscriber;
+    uint64_t mConnection { 0 };
+#endif
+    ScopedConnection(const ScopedConnection&) = delete;
+    ScopedConnection& operator=(const ScopedConnection&) = delete;
+};
+
+inline ScopedConnection Subscribable::connect(Subscribable& subscriber)
+{
+    return subscribe(subscriber) ? ScopedConnection(*this, subscriber) : ScopedConnection();
+}
+
 } // namespace dst
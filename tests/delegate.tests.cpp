@@ -12,6 +12,10 @@
 
 #include "catch2/catch.hpp"
 
+#include <functional>
+#include <memory>
+#include <set>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -55,6 +59,48 @@ TEST_CASE("Delegate<>::operator+=()", "[Delegate<>]")
     CHECK(actualValue == targetValue);
 }
 
+/**
+Validates that Delegate<> objects subscribed via Delegate<>::connect() are unsubscribed when their ScopedConnection is destroyed
+*/
+TEST_CASE("Delegate<>::connect()", "[Delegate<>][ScopedConnection]")
+{
+    int value = 0;
+    Delegate<int&> delegate;
+    Delegate<int&> subscriber = [](int& value) { ++value; };
+    {
+        auto connection = delegate.connect(subscriber);
+        CHECK(connection.connected());
+        CHECK(!delegate.connect(subscriber).connected());
+        CHECK(!delegate.connect(delegate).connected());
+        delegate(value);
+        CHECK(value == 1);
+    }
+    delegate(value);
+    CHECK(value == 1);
+}
+
+/**
+Validates that Delegate<>::get_subscribers() and Delegate<>::get_subscriptions() view subscribed Delegate<> objects
+*/
+TEST_CASE("Delegate<>::get_subscribers() and Delegate<>::get_subscriptions()", "[Delegate<>]")
+{
+    Delegate<int&> delegate;
+    std::vector<Delegate<int&>> delegates(TestCount);
+    for (auto& subscriber : delegates) {
+        delegate += subscriber;
+    }
+    CHECK(delegate.get_subscribers().size() == delegates.size());
+    CHECK(delegate.get_subscriptions().empty());
+    for (auto pSubscriber : delegate.get_subscribers()) {
+        CHECK(delegate.get_subscribers().count(pSubscriber));
+        CHECK(pSubscriber->get_subscriptions().size() == 1);
+        CHECK(*pSubscriber->get_subscriptions().begin() == &delegate);
+    }
+    delegate -= delegates.front();
+    CHECK(!delegate.get_subscribers().count(&delegates.front()));
+    CHECK(delegates.front().get_subscriptions().empty());
+}
+
 /**
 Validates that Delegate<> move ctor unsubscribes and resubscribes at the new address
 */
@@ -105,5 +151,171 @@ TEST_CASE("Delegate<>::~Delegate()", "[Delegate<>]")
     CHECK(actualValue == targetValue);
 }
 
+/**
+Validates that Delegate<>::Handle follows std::move() and becomes stale when its Delegate<> is destroyed or move assigned to
+*/
+TEST_CASE("Delegate<>::Handle", "[Delegate<>]")
+{
+    CHECK(!Delegate<int&>::Handle().get());
+    auto upDelegate = std::make_unique<Delegate<int&>>();
+    Delegate<int&>::Handle handle(*upDelegate);
+    CHECK(handle.get() == upDelegate.get());
+    auto movedDelegate = std::move(*upDelegate);
+    CHECK(handle.get() == &movedDelegate);
+    upDelegate.reset();
+    CHECK(handle.get() == &movedDelegate);
+    movedDelegate = Delegate<int&>();
+    CHECK(!handle.get());
+    Delegate<int&>::Handle movedHandle(movedDelegate);
+    {
+        auto tempDelegate = std::move(movedDelegate);
+        CHECK(movedHandle.get() == &tempDelegate);
+    }
+    CHECK(!movedHandle.get());
+}
+
+/**
+Validates that Delegate<R(Args...)> feeds return values to combiners
+*/
+TEST_CASE("Delegate<R(Args...)>::invoke()", "[Delegate<>]")
+{
+    int targetSum = 0;
+    Delegate<int(int)> delegate = [](int value) { return value; };
+    std::vector<Delegate<int(int)>> delegates(TestCount);
+    for (size_t i = 0; i < delegates.size(); ++i) {
+        delegate += delegates[i];
+        delegates[i] = [i](int value) { return value + (int)i; };
+        targetSum += 1 + (int)i;
+    }
+    targetSum += 1;
+    SECTION("operator()")
+    {
+        CHECK(delegate(1));
+        Delegate<int(int)> emptyDelegate;
+        CHECK(!emptyDelegate(1));
+    }
+    SECTION("combiner::Sum<>")
+    {
+        combiner::Sum<int> sum;
+        CHECK(delegate.invoke(sum, 1));
+        CHECK(sum.get_result() == targetSum);
+    }
+    SECTION("combiner::Min<> and combiner::Max<>")
+    {
+        combiner::Min<int> min;
+        combiner::Max<int> max;
+        delegate.invoke(min, 1);
+        delegate.invoke(max, 1);
+        CHECK(min.get_result() == 1);
+        CHECK(max.get_result() == TestCount);
+    }
+    SECTION("combiner::Reduce<>")
+    {
+        combiner::Reduce<int, std::function<int(int, int)>> product(1, [](int lhs, int rhs) { return lhs * rhs; });
+        delegate.invoke(product, 0);
+        CHECK(product.get_result() == 0);
+    }
+    SECTION("combiner::First<>")
+    {
+        combiner::First<int> first;
+        CHECK(!delegate.invoke(first, 1));
+        CHECK(first.get_result() == 1);
+    }
+}
+
+/**
+Validates that Delegate<R(Args...)> objects subscribed via Delegate<R(Args...)>::connect() are unsubscribed when their ScopedConnection is destroyed
+*/
+TEST_CASE("Delegate<R(Args...)>::connect()", "[Delegate<>][ScopedConnection]")
+{
+    Delegate<int(int)> delegate = [](int value) { return value; };
+    Delegate<int(int)> subscriber = [](int value) { return value * 2; };
+    {
+        auto connection = delegate.connect(subscriber);
+        CHECK(connection.connected());
+        CHECK(!delegate.connect(subscriber).connected());
+        combiner::Sum<int> sum;
+        CHECK(delegate.invoke(sum, 1));
+        CHECK(sum.get_result() == 3);
+    }
+    combiner::Sum<int> sum;
+    CHECK(delegate.invoke(sum, 1));
+    CHECK(sum.get_result() == 1);
+}
+
+/**
+Validates that Delegate<R(Args...)> stops calling subscribers when a combiner short-circuits
+*/
+TEST_CASE("Delegate<R(Args...)>::invoke() short-circuit", "[Delegate<>]")
+{
+    int callCount = 0;
+    Delegate<bool(int)> delegate;
+    std::vector<Delegate<bool(int)>> delegates(TestCount);
+    for (auto& subscriber : delegates) {
+        delegate += subscriber;
+        subscriber = [&callCount](int value) { ++callCount; return value != 0; };
+    }
+    SECTION("combiner::All<>")
+    {
+        combiner::All<> all;
+        CHECK(!delegate.invoke(all, 0));
+        CHECK(!all.get_result());
+        CHECK(callCount == 1);
+        all = { };
+        CHECK(delegate.invoke(all, 1));
+        CHECK(all.get_result());
+        CHECK(callCount == 1 + TestCount);
+    }
+    SECTION("combiner::Any<>")
+    {
+        combiner::Any<> any;
+        CHECK(!delegate.invoke(any, 1));
+        CHECK(any.get_result());
+        CHECK(callCount == 1);
+        any = { };
+        CHECK(delegate.invoke(any, 0));
+        CHECK(!any.get_result());
+        CHECK(callCount == 1 + TestCount);
+    }
+}
+
+/**
+Validates that Delegate<> is no larger than its members and doesn't carry a vtable pointer
+*/
+TEST_CASE("sizeof(Delegate<>)", "[Delegate<>]")
+{
+    CHECK(!std::is_polymorphic<Subscribable>::value);
+    CHECK(!std::is_polymorphic<Delegate<int>>::value);
+    struct DelegateLayout final
+    {
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+        uint32_t subscribers;
+        uint32_t subscriptions;
+#else
+        std::set<Subscribable*> subscribers;
+        std::set<Subscribable*> subscriptions;
+#endif
+        uint32_t slot;
+        Action<int> action;
+    };
+    struct PolymorphicDelegateLayout final
+    {
+        void* pVtable;
+#ifdef DST_FUNCTIONAL_COMPACT_SUBSCRIBABLE
+        uint32_t subscribers;
+        uint32_t subscriptions;
+#else
+        std::set<Subscribable*> subscribers;
+        std::set<Subscribable*> subscriptions;
+#endif
+        Action<int> action;
+    };
+    CHECK(sizeof(Delegate<int>) == sizeof(DelegateLayout));
+    CHECK(sizeof(Delegate<int(int)>) == sizeof(DelegateLayout));
+    CHECK(sizeof(Delegate<int>) <= sizeof(PolymorphicDelegateLayout));
+    Delegate<int> delegate;
+    CHECK(delegate.get_memory_usage() == sizeof(Delegate<int>));
+}
+
 } // namespace tests
 } // namespace dst
@@ -86,6 +86,23 @@ TEST_CASE("Event<>::operator+=()", "[Event<>]")
     }
 }
 
+/**
+Validates that Delegate<> objects subscribed via Event<>::connect() are unsubscribed when their ScopedConnection is destroyed
+*/
+TEST_CASE("Event<>::connect()", "[Event<>][ScopedConnection]")
+{
+    Publisher publisher;
+    Listener listener;
+    {
+        auto connection = publisher.on_publish.connect(listener.publish_handler);
+        CHECK(connection.connected());
+        CHECK(!publisher.on_publish.connect(listener.publish_handler).connected());
+        publisher.publish("the");
+    }
+    publisher.publish("quick");
+    CHECK(listener.sentence == "the");
+}
+
 /**
 Validates that Event<> move ctor unsubscribes and resubscribes at the new address
 */
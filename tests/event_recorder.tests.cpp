@@ -0,0 +1,178 @@
+
+/*
+==========================================
+  Copyright (c) 2021 Dynamic_Static
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/functional.hpp"
+#include "dynamic_static/functional/event_recorder.hpp"
+#include "dynamic_static/functional/memory_mapped_file.hpp"
+#include "dynamic_static/random.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+static constexpr int TestCount { 16 };
+
+class Recorded final
+{
+public:
+    void publish(int index, const std::string& str)
+    {
+        on_publish(std::move(index), str);
+    }
+
+    Event<Recorded, int, const std::string&> on_publish;
+};
+
+/**
+Gets a unique path in the temp directory for a test's event log
+@param [in] pName The name of the test the event log is for
+@return The path for the test's event log
+    @note The random suffix keeps test targets running concurrently from sharing an event log
+*/
+static std::filesystem::path get_event_log_path(const char* pName)
+{
+    auto fileName = std::string("dynamic_static.functional.") + pName + "." + std::to_string(std::random_device()()) + ".log";
+    return std::filesystem::temp_directory_path() / fileName;
+}
+
+/**
+Validates that EventReplayer<> replays the calls recorded by EventRecorder<> in order
+*/
+TEST_CASE("EventRecorder<> and EventReplayer<>", "[EventRecorder<>][EventReplayer<>]")
+{
+    auto eventLogPath = get_event_log_path("record_replay");
+    RandomNumberGenerator rng;
+    std::vector<std::pair<int, std::string>> published;
+    {
+        Recorded recorded;
+        EventRecorder<int, const std::string&> eventRecorder;
+        REQUIRE(eventRecorder.open(eventLogPath, 64));
+        recorded.on_publish += eventRecorder.get_delegate();
+        for (int i = 0; i < TestCount; ++i) {
+            published.emplace_back(i, std::string(rng.range<size_t>(0, 64), 'a' + (char)i));
+            recorded.publish(published.back().first, published.back().second);
+        }
+        CHECK(eventRecorder.get_record_count() == published.size());
+    }
+    CHECK(std::filesystem::file_size(eventLogPath) < 64 * published.size() + 64 * 64);
+    std::vector<std::pair<int, std::string>> replayed;
+    Delegate<int, const std::string&> delegate = [&](int index, const std::string& str)
+    {
+        replayed.emplace_back(index, str);
+    };
+    EventReplayer<int, const std::string&> eventReplayer;
+    REQUIRE(eventReplayer.open(eventLogPath));
+    CHECK(eventReplayer.replay(delegate) == published.size());
+    CHECK(replayed == published);
+    eventReplayer.close();
+    std::filesystem::remove(eventLogPath);
+}
+
+/**
+Validates that EventReplayer<> can replay with the timing calls were recorded with
+*/
+TEST_CASE("EventReplayer<>::replay(ReplayTiming::Original)", "[EventReplayer<>]")
+{
+    auto eventLogPath = get_event_log_path("replay_original_timing");
+    auto delay = std::chrono::milliseconds(20);
+    {
+        EventRecorder<int> eventRecorder;
+        REQUIRE(eventRecorder.open(eventLogPath));
+        eventRecorder.record(0);
+        std::this_thread::sleep_for(delay);
+        eventRecorder.record(1);
+    }
+    int replayCount = 0;
+    Delegate<int> delegate = [&](int value) { CHECK(value == replayCount++); };
+    EventReplayer<int> eventReplayer;
+    REQUIRE(eventReplayer.open(eventLogPath));
+    auto begin = std::chrono::steady_clock::now();
+    CHECK(eventReplayer.replay(delegate, ReplayTiming::Original) == 2);
+    CHECK(delay <= std::chrono::steady_clock::now() - begin);
+    CHECK(replayCount == 2);
+    eventReplayer.close();
+    std::filesystem::remove(eventLogPath);
+}
+
+/**
+Validates that EventReplayer<> stops at a record whose arguments don't match its size
+*/
+TEST_CASE("EventReplayer<>::replay() corrupted event log", "[EventReplayer<>]")
+{
+    auto eventLogPath = get_event_log_path("replay_corrupted");
+    {
+        EventRecorder<int, const std::string&> eventRecorder;
+        REQUIRE(eventRecorder.open(eventLogPath));
+        eventRecorder.record(0, "abc");
+        eventRecorder.record(1, "abc");
+        eventRecorder.record(2, "abc");
+    }
+    auto recordSize = sizeof(EventLogRecordHeader) + sizeof(int) + sizeof(uint64_t) + 3;
+    auto stringSizeOffset = sizeof(EventLogHeader) + recordSize + sizeof(EventLogRecordHeader) + sizeof(int);
+    auto write_string_size = [&](uint64_t stringSize)
+    {
+        std::fstream file(eventLogPath, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp((std::streamoff)stringSizeOffset);
+        file.write((const char*)&stringSize, sizeof(stringSize));
+    };
+    int replayCount = 0;
+    Delegate<int, const std::string&> delegate = [&](int index, const std::string& str)
+    {
+        CHECK(index == replayCount++);
+        CHECK(str == "abc");
+    };
+    EventReplayer<int, const std::string&> eventReplayer;
+    SECTION("String size past the end of the event log")
+    {
+        write_string_size(1ull << 30);
+        REQUIRE(eventReplayer.open(eventLogPath));
+        CHECK(eventReplayer.replay(delegate) == 1);
+    }
+    SECTION("String size short of the record size")
+    {
+        write_string_size(1);
+        REQUIRE(eventReplayer.open(eventLogPath));
+        CHECK(eventReplayer.replay(delegate) == 1);
+    }
+    CHECK(replayCount == 1);
+    eventReplayer.close();
+    std::filesystem::remove(eventLogPath);
+}
+
+/**
+Validates that MemoryMappedFile keeps its mapping when resize() fails
+*/
+TEST_CASE("MemoryMappedFile::resize()", "[MemoryMappedFile]")
+{
+    auto eventLogPath = get_event_log_path("memory_mapped_file_resize");
+    MemoryMappedFile memoryMappedFile;
+    REQUIRE(memoryMappedFile.open(eventLogPath, MemoryMappedFile::Mode::ReadWrite));
+    REQUIRE(memoryMappedFile.resize(64));
+    memoryMappedFile.get_data()[0] = 1;
+    CHECK(!memoryMappedFile.resize(1ull << 62));
+    REQUIRE(memoryMappedFile.is_open());
+    CHECK(memoryMappedFile.get_size() == 64);
+    REQUIRE(memoryMappedFile.get_data());
+    CHECK(memoryMappedFile.get_data()[0] == 1);
+    memoryMappedFile.close();
+    std::filesystem::remove(eventLogPath);
+}
+
+} // namespace tests
+} // namespace dst
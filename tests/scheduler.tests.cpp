@@ -0,0 +1,190 @@
+
+/*
+==========================================
+  Copyright (c) 2021 Dynamic_Static
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/functional.hpp"
+#include "dynamic_static/random.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+static constexpr int TestCount { 16 };
+
+/**
+Validates that Scheduler<> calls Delegate<> objects on the tick they expire
+*/
+TEST_CASE("Scheduler<>::schedule()", "[Scheduler<>]")
+{
+    RandomNumberGenerator rng;
+    Scheduler<uint64_t> scheduler;
+    std::vector<uint64_t> expirations;
+    std::vector<uint64_t> firedTicks;
+    Delegate<uint64_t> delegate = [&](uint64_t expiration)
+    {
+        CHECK(expiration == scheduler.get_tick() - 1);
+        firedTicks.push_back(expiration);
+    };
+    for (int i = 0; i < TestCount * TestCount; ++i) {
+        auto delay = rng.range<uint64_t>(0, 1 << 18);
+        expirations.push_back(delay);
+        scheduler.schedule(delegate, delay, delay);
+    }
+    CHECK(scheduler.get_pending_count() == expirations.size());
+    scheduler.tick((1 << 18) + 1);
+    CHECK(firedTicks.size() == expirations.size());
+    CHECK(!scheduler.get_pending_count());
+}
+
+/**
+Validates that Scheduler<> cascades long delays through every level of its timing wheel, including delays past its maximum delta
+*/
+TEST_CASE("Scheduler<>::schedule() long delays", "[Scheduler<>]")
+{
+    RandomNumberGenerator rng;
+    Scheduler<uint64_t> scheduler;
+    size_t firedCount = 0;
+    Delegate<uint64_t> delegate = [&](uint64_t expiration)
+    {
+        CHECK(expiration == scheduler.get_tick() - 1);
+        ++firedCount;
+    };
+    scheduler.tick(123);
+    std::vector<uint64_t> delays { 1ull << 24, (1ull << 32) - 1, 1ull << 32, (1ull << 32) + 1, 1ull << 40 };
+    for (int i = 0; i < TestCount; ++i) {
+        delays.push_back(rng.range<uint64_t>((1ull << 24) + 1, 1ull << 32));
+        delays.push_back(rng.range<uint64_t>(1ull << 32, 1ull << 36));
+    }
+    uint64_t maxExpiration = 0;
+    for (auto delay : delays) {
+        auto expiration = scheduler.get_tick() + delay;
+        maxExpiration = std::max(maxExpiration, expiration);
+        scheduler.schedule(delegate, delay, expiration);
+    }
+    scheduler.tick(1ull << 24);
+    CHECK(!firedCount);
+    scheduler.tick(1);
+    CHECK(firedCount == 1);
+    scheduler.tick(maxExpiration + 1 - scheduler.get_tick());
+    CHECK(firedCount == delays.size());
+    CHECK(!scheduler.get_pending_count());
+}
+
+/**
+Validates that Scheduler<> calls periodic Delegate<> objects until cancelled
+*/
+TEST_CASE("Scheduler<>::schedule_periodic()", "[Scheduler<>]")
+{
+    int callCount = 0;
+    Scheduler<const std::string&> scheduler;
+    Scheduler<const std::string&>::Timer timer;
+    Delegate<const std::string&> delegate = [&](const std::string& str)
+    {
+        CHECK(str == "tick");
+        if (++callCount == TestCount) {
+            CHECK(scheduler.cancel(timer));
+        }
+    };
+    timer = scheduler.schedule_periodic(delegate, 3, 5, "tick");
+    scheduler.tick(4);
+    CHECK(callCount == 1);
+    scheduler.tick(5);
+    CHECK(callCount == 2);
+    scheduler.tick(5 * TestCount);
+    CHECK(callCount == TestCount);
+    CHECK(!scheduler.is_pending(timer));
+    CHECK(!scheduler.cancel(timer));
+    CHECK(!scheduler.get_pending_count());
+}
+
+/**
+Validates that Scheduler<> stores arguments that can't be default constructed or assigned
+*/
+TEST_CASE("Scheduler<>::schedule() non default constructible arguments", "[Scheduler<>]")
+{
+    struct Argument final
+    {
+        explicit Argument(int value_)
+            : value { value_ }
+        {
+        }
+
+        Argument(const Argument&) = default;
+        Argument& operator=(const Argument&) = delete;
+        const int value;
+    };
+    std::vector<int> values;
+    Scheduler<const Argument&> scheduler;
+    Delegate<const Argument&> delegate = [&](const Argument& argument) { values.push_back(argument.value); };
+    for (int i = 0; i < TestCount; ++i) {
+        scheduler.schedule(delegate, i, Argument(i));
+    }
+    scheduler.tick(TestCount);
+    std::vector<int> expected(TestCount);
+    for (int i = 0; i < TestCount; ++i) {
+        expected[i] = i;
+    }
+    std::sort(values.begin(), values.end());
+    CHECK(values == expected);
+    CHECK(!scheduler.get_pending_count());
+}
+
+/**
+Validates that Scheduler<> Timer objects are cancelled, follow std::move(), and are cancelled when their Delegate<> is destroyed
+*/
+TEST_CASE("Scheduler<>::cancel()", "[Scheduler<>]")
+{
+    int callCount = 0;
+    Scheduler<int&> scheduler;
+    std::vector<Scheduler<int&>::Timer> timers;
+    std::vector<Delegate<int&>> delegates(TestCount);
+    for (auto& delegate : delegates) {
+        delegate = [&callCount](int& value) { callCount += value; };
+        timers.push_back(scheduler.schedule(delegate, 1, 1));
+    }
+    CHECK(scheduler.cancel(timers[0]));
+    CHECK(!scheduler.cancel(timers[0]));
+    auto movedDelegate = std::move(delegates[1]);
+    delegates.pop_back();
+    scheduler.tick(2);
+    CHECK(callCount == TestCount - 2);
+    CHECK(!scheduler.get_pending_count());
+    for (const auto& timer : timers) {
+        CHECK(!scheduler.is_pending(timer));
+    }
+}
+
+/**
+Validates that Scheduler<> Timer objects are cancelled when a Delegate<> is move assigned into their Delegate<>
+*/
+TEST_CASE("Scheduler<>::cancel() move assignment", "[Scheduler<>]")
+{
+    int callCount0 = 0;
+    int callCount1 = 0;
+    Scheduler<> scheduler;
+    Delegate<> delegate0 = [&]() { ++callCount0; };
+    Delegate<> delegate1 = [&]() { ++callCount1; };
+    auto timer = scheduler.schedule(delegate0, 1);
+    delegate0 = std::move(delegate1);
+    delegate1 = [&]() { ++callCount1; };
+    scheduler.tick(2);
+    CHECK(!callCount0);
+    CHECK(!callCount1);
+    CHECK(!scheduler.is_pending(timer));
+    CHECK(!scheduler.get_pending_count());
+}
+
+} // namespace tests
+} // namespace dst
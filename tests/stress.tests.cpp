@@ -0,0 +1,321 @@
+
+/*
+==========================================
+  Copyright (c) 2021 Dynamic_Static
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/functional.hpp"
+#include "dynamic_static/random.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+/**
+Tracks the bytes allocated through the global operator new() replaced below
+    @note Tests run on a single thread so the counts aren't synchronized
+*/
+struct AllocationCounter final
+{
+    size_t allocatedBytes { 0 };
+    size_t peakAllocatedBytes { 0 };
+};
+
+static AllocationCounter sAllocationCounter;
+
+/**
+The size of the header that records each allocation's size, keeps allocations aligned for any scalar type
+*/
+static constexpr size_t AllocationHeaderSize = alignof(std::max_align_t);
+
+} // namespace tests
+} // namespace dst
+
+void* operator new(std::size_t size)
+{
+    using namespace dst::tests;
+    auto pAllocation = static_cast<uint8_t*>(std::malloc(AllocationHeaderSize + size));
+    if (!pAllocation) {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<size_t*>(pAllocation) = size;
+    sAllocationCounter.allocatedBytes += size;
+    sAllocationCounter.peakAllocatedBytes = std::max(sAllocationCounter.peakAllocatedBytes, sAllocationCounter.allocatedBytes);
+    return pAllocation + AllocationHeaderSize;
+}
+
+void operator delete(void* pMemory) noexcept
+{
+    using namespace dst::tests;
+    if (pMemory) {
+        auto pAllocation = static_cast<uint8_t*>(pMemory) - AllocationHeaderSize;
+        sAllocationCounter.allocatedBytes -= *reinterpret_cast<size_t*>(pAllocation);
+        std::free(pAllocation);
+    }
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return operator new(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return operator new(size, std::nothrow);
+}
+
+void operator delete(void* pMemory, std::size_t) noexcept
+{
+    operator delete(pMemory);
+}
+
+void operator delete(void* pMemory, const std::nothrow_t&) noexcept
+{
+    operator delete(pMemory);
+}
+
+void operator delete[](void* pMemory) noexcept
+{
+    operator delete(pMemory);
+}
+
+void operator delete[](void* pMemory, std::size_t) noexcept
+{
+    operator delete(pMemory);
+}
+
+void operator delete[](void* pMemory, const std::nothrow_t&) noexcept
+{
+    operator delete(pMemory);
+}
+
+namespace dst {
+namespace tests {
+
+/*
+Randomized graphs of Delegate<> objects are split into publishers and handlers,
+    handlers only subscribe to publishers so firing never recurses past one level
+    regardless of graph size.
+*/
+
+using StressDelegate = Delegate<size_t&>;
+
+enum class Operation
+{
+    Subscribe,
+    Unsubscribe,
+    Move,
+    Destroy,
+    Fire,
+    Count,
+};
+
+static constexpr std::array<const char*, (size_t)Operation::Count> OperationNames {
+    "subscribe",
+    "unsubscribe",
+    "move",
+    "destroy",
+    "fire",
+};
+
+struct OperationStats final
+{
+    size_t count { 0 };
+    std::chrono::nanoseconds duration { 0 };
+    size_t peakAllocatedBytes { 0 };
+    int64_t allocatedBytesChange { 0 };
+};
+
+static size_t random_index(RandomNumberGenerator& rng, size_t count)
+{
+    assert(count);
+    return 1 < count ? std::min(rng.range<size_t>(0, count - 1), count - 1) : 0;
+}
+
+static std::unique_ptr<StressDelegate> create_handler()
+{
+    return std::make_unique<StressDelegate>([](size_t& callCount) { ++callCount; });
+}
+
+static void validate_graph(const std::vector<std::unique_ptr<StressDelegate>>& delegates)
+{
+    size_t subscriberCount = 0;
+    size_t subscriptionCount = 0;
+    for (const auto& upDelegate : delegates) {
+        for (auto pSubscriber : upDelegate->get_subscribers()) {
+            if (!pSubscriber->get_subscriptions().count(upDelegate.get())) {
+                FAIL("Subscriber is missing its subscription");
+            }
+            ++subscriberCount;
+        }
+        for (auto pSubscription : upDelegate->get_subscriptions()) {
+            if (!pSubscription->get_subscribers().count(upDelegate.get())) {
+                FAIL("Subscription is missing its subscriber");
+            }
+            ++subscriptionCount;
+        }
+    }
+    CHECK(subscriberCount == subscriptionCount);
+}
+
+static void report_stress(size_t nodeCount, const std::array<OperationStats, (size_t)Operation::Count>& operationStats, size_t peakAllocatedBytes)
+{
+    std::cout << "Delegate<> stress : " << nodeCount << " nodes, peak allocated " << peakAllocatedBytes << " bytes" << std::endl;
+    std::cout << "    (memory figures are bytes measured through operator new(), peak is the most allocated during a single operation)" << std::endl;
+    for (size_t i = 0; i < operationStats.size(); ++i) {
+        const auto& stats = operationStats[i];
+        auto nanosecondsPerOperation = stats.count ? (double)stats.duration.count() / stats.count : 0.0;
+        std::cout
+            << "    " << std::left << std::setw(12) << OperationNames[i] << std::right
+            << std::setw(12) << stats.count << " ops"
+            << std::setw(12) << std::fixed << std::setprecision(1) << nanosecondsPerOperation << " ns/op"
+            << std::setw(12) << stats.peakAllocatedBytes << " peak bytes"
+            << std::setw(16) << std::showpos << stats.allocatedBytesChange << std::noshowpos << " bytes net"
+            << std::endl;
+    }
+}
+
+/**
+Builds a randomized graph and interleaves random operations on it
+@param [in] nodeCount The number of Delegate<> objects in the graph
+@param [in] operationCount The number of random operations to perform after the graph is built
+@param [in] report Whether or not to write timing and allocations per operation class to std::cout
+    @note Only the operation itself is timed and measured, picking operands happens outside the measured region
+*/
+static void run_stress(size_t nodeCount, size_t operationCount, bool report)
+{
+    auto baseAllocatedBytes = sAllocationCounter.allocatedBytes;
+    size_t peakAllocatedBytes = 0;
+    RandomNumberGenerator rng;
+    auto publisherCount = std::max<size_t>(nodeCount / 4, 1);
+    std::vector<std::unique_ptr<StressDelegate>> delegates(nodeCount);
+    for (size_t i = 0; i < delegates.size(); ++i) {
+        delegates[i] = i < publisherCount ? std::make_unique<StressDelegate>() : create_handler();
+    }
+    std::array<OperationStats, (size_t)Operation::Count> operationStats { };
+    auto execute = [&](Operation operation, size_t index)
+    {
+        auto& delegate = *delegates[index];
+        auto& stats = operationStats[(size_t)operation];
+        size_t callCount = 0;
+        auto measured = [&](auto function)
+        {
+            auto allocatedBytes = sAllocationCounter.allocatedBytes;
+            sAllocationCounter.peakAllocatedBytes = allocatedBytes;
+            auto begin = std::chrono::steady_clock::now();
+            function();
+            stats.duration += std::chrono::steady_clock::now() - begin;
+            stats.peakAllocatedBytes = std::max(stats.peakAllocatedBytes, sAllocationCounter.peakAllocatedBytes - allocatedBytes);
+            stats.allocatedBytesChange += (int64_t)sAllocationCounter.allocatedBytes - (int64_t)allocatedBytes;
+            peakAllocatedBytes = std::max(peakAllocatedBytes, sAllocationCounter.peakAllocatedBytes - baseAllocatedBytes);
+        };
+        switch (operation) {
+        case Operation::Subscribe: {
+            auto& publisher = *delegates[random_index(rng, publisherCount)];
+            measured([&]() { publisher += delegate; });
+        } break;
+        case Operation::Unsubscribe: {
+            auto subscriptions = delegate.get_subscriptions();
+            if (!subscriptions.empty()) {
+                auto& publisher = **subscriptions.begin();
+                measured([&]() { publisher -= delegate; });
+            } else {
+                measured([]() { });
+            }
+        } break;
+        case Operation::Move: {
+            measured([&]()
+            {
+                auto moved = std::move(delegate);
+                delegate = std::move(moved);
+            });
+        } break;
+        case Operation::Destroy: {
+            auto upDelegate = index < publisherCount ? std::make_unique<StressDelegate>() : create_handler();
+            measured([&]() { delegates[index] = std::move(upDelegate); });
+        } break;
+        case Operation::Fire: {
+            measured([&]() { delegate(callCount); });
+        } break;
+        default: {
+            assert(false);
+        } break;
+        }
+        ++stats.count;
+        if (operation == Operation::Fire && callCount != delegate.get_subscribers().size()) {
+            FAIL("Fire didn't reach every subscriber");
+        }
+    };
+    for (size_t i = publisherCount; i < nodeCount; ++i) {
+        execute(Operation::Subscribe, i);
+        execute(Operation::Subscribe, i);
+    }
+    for (size_t i = 0; i < operationCount; ++i) {
+        auto percentile = rng.range<uint32_t>(0, 99);
+        if (percentile < 30) {
+            execute(Operation::Subscribe, publisherCount + random_index(rng, nodeCount - publisherCount));
+        } else if (percentile < 50) {
+            execute(Operation::Unsubscribe, publisherCount + random_index(rng, nodeCount - publisherCount));
+        } else if (percentile < 60) {
+            execute(Operation::Move, random_index(rng, nodeCount));
+        } else if (percentile < 70) {
+            execute(Operation::Destroy, random_index(rng, nodeCount));
+        } else {
+            execute(Operation::Fire, random_index(rng, publisherCount));
+        }
+    }
+    validate_graph(delegates);
+    CHECK(0 < peakAllocatedBytes);
+    if (report) {
+        report_stress(nodeCount, operationStats, peakAllocatedBytes);
+    }
+}
+
+/**
+Validates that a randomized Delegate<> graph stays symmetric through interleaved operations
+*/
+TEST_CASE("Delegate<> randomized graph", "[Delegate<>][Subscribable]")
+{
+    run_stress(1024, 8 * 1024, false);
+}
+
+/**
+Measures Delegate<> operations on randomized graphs of increasing size
+    @note This test is hidden, run it explicitly with the [stress] tag
+*/
+TEST_CASE("Delegate<> randomized graph stress", "[.][stress]")
+{
+    for (size_t nodeCount = 1 << 14; nodeCount <= 1 << 20; nodeCount <<= 2) {
+        run_stress(nodeCount, 4 * nodeCount, true);
+    }
+}
+
+} // namespace tests
+} // namespace dst
@@ -110,5 +110,135 @@ TEST_CASE("Subscribable::~Subscribable()", "[Subscribable]")
     CHECK(subscribable.get_subscribers().empty());
 }
 
+/**
+Validates that ScopedConnection unsubscribes when destroyed
+*/
+TEST_CASE("ScopedConnection::~ScopedConnection()", "[ScopedConnection]")
+{
+    Subscribable subscribable;
+    std::vector<Subscribable> subscribers(TestCount);
+    {
+        std::vector<ScopedConnection> connections;
+        for (auto& subscriber : subscribers) {
+            connections.push_back(subscribable.connect(subscriber));
+            CHECK(connections.back().connected());
+        }
+        CHECK(subscribable.get_subscribers().size() == subscribers.size());
+        connections.front().release();
+        connections.back().disconnect();
+        CHECK(!connections.back().connected());
+        CHECK(subscribable.get_subscribers().size() == subscribers.size() - 1);
+    }
+    CHECK(subscribable.get_subscribers().size() == 1);
+    CHECK(subscribable.get_subscribers().count(&subscribers.front()));
+    CHECK(!subscribable.connect(subscribable).connected());
+    {
+        auto connection = subscribable.connect(subscribers.back());
+        CHECK(!subscribable.connect(subscribers.back()).connected());
+        CHECK(connection.connected());
+    }
+    CHECK(subscribable.get_subscribers().size() == 1);
+}
+
+/**
+Validates that ScopedConnection follows std::move() and is a noop after either Subscribable is destroyed
+*/
+TEST_CASE("ScopedConnection::disconnect()", "[ScopedConnection]")
+{
+    SECTION("std::move()")
+    {
+        Subscribable subscribable0;
+        Subscribable subscribable1;
+        auto connection = subscribable0.connect(subscribable1);
+        auto move0 = std::move(subscribable0);
+        auto move1 = std::move(subscribable1);
+        CHECK(connection.connected());
+        connection.disconnect();
+        CHECK(move0.get_subscribers().empty());
+        CHECK(move1.get_subscriptions().empty());
+    }
+    SECTION("Subscribable::operator=(Subscribable&&)")
+    {
+        Subscribable publisher;
+        Subscribable subscribable0;
+        Subscribable subscribable1;
+        auto connection = publisher.connect(subscribable0);
+        subscribable0 = std::move(subscribable1);
+        CHECK(!connection.connected());
+        publisher += subscribable1;
+        connection.disconnect();
+        CHECK(publisher.get_subscribers().count(&subscribable1));
+    }
+    SECTION("Subscribable::operator-=()")
+    {
+        Subscribable publisher;
+        Subscribable subscriber;
+        auto connection0 = publisher.connect(subscriber);
+        publisher -= subscriber;
+        auto connection1 = publisher.connect(subscriber);
+        CHECK(!connection0.connected());
+        CHECK(connection1.connected());
+        connection0.disconnect();
+        CHECK(connection1.connected());
+        CHECK(publisher.get_subscribers().count(&subscriber));
+        publisher -= subscriber;
+        publisher += subscriber;
+        CHECK(!connection1.connected());
+        connection1.disconnect();
+        CHECK(publisher.get_subscribers().count(&subscriber));
+    }
+    SECTION("~Subscribable()")
+    {
+        Subscribable subscribable;
+        std::vector<ScopedConnection> connections;
+        {
+            std::vector<Subscribable> subscribers(TestCount);
+            for (auto& subscriber : subscribers) {
+                connections.push_back(subscribable.connect(subscriber));
+            }
+        }
+        std::vector<Subscribable> subscribers(TestCount);
+        for (auto& subscriber : subscribers) {
+            subscribable += subscriber;
+        }
+        for (auto& connection : connections) {
+            CHECK(!connection.connected());
+        }
+        connections.clear();
+        CHECK(subscribable.get_subscribers().size() == subscribers.size());
+    }
+}
+
+/**
+Validates that Subscribable::get_memory_usage() accounts for each subscription once
+*/
+TEST_CASE("Subscribable::get_memory_usage()", "[Subscribable]")
+{
+    std::vector<Subscribable> subscribables(TestCount);
+    auto get_memory_usage = [&]()
+    {
+        size_t memoryUsage = 0;
+        for (const auto& subscribable : subscribables) {
+            memoryUsage += subscribable.get_memory_usage();
+        }
+        return memoryUsage;
+    };
+    auto emptyMemoryUsage = get_memory_usage();
+    CHECK(emptyMemoryUsage == subscribables.size() * sizeof(Subscribable));
+    subscribables[0] += subscribables[1];
+    auto edgeMemoryUsage = get_memory_usage() - emptyMemoryUsage;
+    CHECK(edgeMemoryUsage);
+    CHECK(subscribables[0].get_memory_usage() == sizeof(Subscribable) + edgeMemoryUsage);
+    CHECK(subscribables[1].get_memory_usage() == sizeof(Subscribable));
+    for (auto& subscriber : subscribables) {
+        subscribables[0] += subscriber;
+    }
+    CHECK(get_memory_usage() == emptyMemoryUsage + (subscribables.size() - 1) * edgeMemoryUsage);
+    for (auto& subscribable : subscribables) {
+        subscribable.clear();
+    }
+    CHECK(get_memory_usage() == emptyMemoryUsage);
+}
+
 } // namespace tests
 } // namespace dst